@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "starkware/air/air.h"
+#include "starkware/air/boundary/boundary_composition_polynomial.h"
 #include "starkware/algebra/fields/fraction_field_element.h"
 #include "starkware/algebra/utils/invoke_template_version.h"
 
@@ -29,6 +30,8 @@ namespace starkware {
 /*
   A simple AIR the describes the contraints:
     (column_i(x) - y0_i) / (x - x0_i).
+  Its composition polynomial is a BoundaryCompositionPolynomial. ConstraintsEval() allows evaluating
+  it through the generic CompositionPolynomialImpl (see Builder) as well.
 */
 template <typename FieldElementT>
 class BoundaryAir : public Air {
@@ -78,11 +81,25 @@ class BoundaryAir : public Air {
   std::unique_ptr<CompositionPolynomial> CreateCompositionPolynomial(
       const FieldElement& trace_generator,
       const ConstFieldElementSpan& random_coefficients) const override {
-    Builder builder(0);
-    FieldElementT gen = trace_generator.As<FieldElementT>();
+    using ConstraintGroup = typename BoundaryCompositionPolynomial<FieldElementT>::ConstraintGroup;
+    const auto coefficients = random_coefficients.As<FieldElementT>();
+    ASSERT_RELEASE(
+        coefficients.size() == constraints_.size(), "Wrong number of random coefficients");
 
-    return builder.BuildUniquePtr(
-        UseOwned(this), gen, TraceLength(), random_coefficients.As<FieldElementT>(), {}, {});
+    // constraints_ is ordered such that constraints with the same point_x are adjacent.
+    std::vector<ConstraintGroup> groups;
+    for (const ConstraintData& constraint : constraints_) {
+      if (groups.empty() || groups.back().point_x != constraint.point_x) {
+        groups.push_back(ConstraintGroup{constraint.point_x, {}, FieldElementT::Zero()});
+      }
+      const FieldElementT& coefficient = coefficients[constraint.coeff_idx];
+      groups.back().terms.emplace_back(constraint.column_index, coefficient);
+      groups.back().constant += coefficient * constraint.point_y;
+    }
+
+    return std::make_unique<BoundaryCompositionPolynomial<FieldElementT>>(
+        trace_generator.As<FieldElementT>(), TraceLength(), GetCompositionPolynomialDegreeBound(),
+        std::move(groups));
   };
 
   std::vector<std::vector<FieldElementT>> PrecomputeDomainEvalsOnCoset(
@@ -126,5 +126,80 @@ TEST(BoundaryAir, Soundness) {
   EXPECT_EQ(num_of_cosets * air.GetCompositionPolynomialDegreeBound() - 1, actual_degree);
 }
 
+/*
+  Checks that the specialized composition polynomial of BoundaryAir agrees with the generic
+  CompositionPolynomialImpl, both on a coset and on a single point.
+*/
+TEST(BoundaryAir, CompositionPolynomialMatchesGeneric) {
+  Prng prng;
+
+  const size_t n_columns = 10;
+  const size_t n_points = 3;
+  const size_t n_conditions = 20;
+  const uint64_t trace_length = 256;
+  const FieldElementT trace_generator = GetSubGroupGenerator<FieldElementT>(trace_length);
+
+  // Several conditions share each point, as in the out of domain sampling.
+  const std::vector<FieldElementT> points = prng.RandomFieldElementVector<FieldElementT>(n_points);
+  std::vector<std::tuple<size_t, FieldElement, FieldElement>> boundary_conditions;
+  for (size_t condition_index = 0; condition_index < n_conditions; ++condition_index) {
+    boundary_conditions.emplace_back(
+        prng.UniformInt<size_t>(0, n_columns - 1),
+        points[prng.UniformInt<size_t>(0, n_points - 1)], FieldElementT::RandomElement(&prng));
+  }
+  BoundaryAir<FieldElementT> air(trace_length, n_columns, boundary_conditions);
+  FieldElementVector random_coefficients = FieldElementVector::Make(
+      prng.RandomFieldElementVector<FieldElementT>(air.NumRandomCoefficients()));
+
+  std::unique_ptr<CompositionPolynomial> composition_polynomial =
+      air.CreateCompositionPolynomial(FieldElement(trace_generator), random_coefficients);
+  BoundaryAir<FieldElementT>::Builder builder(0);
+  auto generic_composition_polynomial = builder.BuildUniquePtr(
+      UseOwned(&air), trace_generator, trace_length, random_coefficients.As<FieldElementT>(), {},
+      {});
+
+  std::vector<FieldElementVector> columns;
+  std::vector<ConstFieldElementSpan> trace_lde;
+  columns.reserve(n_columns);
+  for (size_t i = 0; i < n_columns; ++i) {
+    columns.push_back(
+        FieldElementVector::Make(prng.RandomFieldElementVector<FieldElementT>(trace_length)));
+    trace_lde.emplace_back(columns.back());
+  }
+
+  const FieldElement coset_offset(FieldElementT::RandomElement(&prng));
+  const Field field = Field::Create<FieldElementT>();
+  auto evaluation = FieldElementVector::MakeUninitialized(field, trace_length);
+  auto expected = FieldElementVector::MakeUninitialized(field, trace_length);
+  // A task size which does not divide the coset size.
+  const uint64_t task_size = 100;
+  composition_polynomial->EvalOnCosetBitReversedOutput(
+      coset_offset, trace_lde, evaluation, task_size);
+  generic_composition_polynomial->EvalOnCosetBitReversedOutput(
+      coset_offset, trace_lde, expected, task_size);
+  EXPECT_EQ(expected, evaluation);
+
+  // The same evaluation, given the columns in bit reversed order.
+  ASSERT_TRUE(composition_polynomial->SupportsBitReversedInput());
+  std::vector<FieldElementVector> bit_reversed_columns;
+  std::vector<ConstFieldElementSpan> bit_reversed_trace_lde;
+  bit_reversed_columns.reserve(n_columns);
+  for (const FieldElementVector& column : columns) {
+    bit_reversed_columns.push_back(FieldElementVector::MakeUninitialized(field, trace_length));
+    BitReverseVector(column, bit_reversed_columns.back());
+    bit_reversed_trace_lde.emplace_back(bit_reversed_columns.back());
+  }
+  composition_polynomial->EvalOnCosetBitReversedInputAndOutput(
+      coset_offset, bit_reversed_trace_lde, evaluation, task_size);
+  EXPECT_EQ(expected, evaluation);
+
+  const FieldElement point(FieldElementT::RandomElement(&prng));
+  const FieldElementVector neighbors =
+      FieldElementVector::Make(prng.RandomFieldElementVector<FieldElementT>(n_columns));
+  EXPECT_EQ(
+      generic_composition_polynomial->EvalAtPoint(point, neighbors),
+      composition_polynomial->EvalAtPoint(point, neighbors));
+}
+
 }  // namespace
 }  // namespace starkware
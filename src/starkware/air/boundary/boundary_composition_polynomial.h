@@ -0,0 +1,107 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#ifndef STARKWARE_AIR_BOUNDARY_BOUNDARY_COMPOSITION_POLYNOMIAL_H_
+#define STARKWARE_AIR_BOUNDARY_BOUNDARY_COMPOSITION_POLYNOMIAL_H_
+
+#include <utility>
+#include <vector>
+
+#include "third_party/gsl/gsl-lite.hpp"
+
+#include "starkware/composition_polynomial/composition_polynomial.h"
+
+namespace starkware {
+
+/*
+  The composition polynomial of BoundaryAir (the DEEP quotient):
+    \sum_k (\sum_{i in group k} c_i * (column_i(x) - y_i)) / (x - x_k),
+  where the constraints are grouped by their point x_k.
+
+  Unlike CompositionPolynomialImpl, which gathers the neighbors of each row and evaluates the
+  constraints row by row, the evaluation on a coset is done column by column: for each group, the
+  columns are accumulated over a batch of rows into a single numerator, so that all the constraints
+  of a group share one denominator per row. The constant part of each numerator,
+  \sum_{i in group k} c_i * y_i, is computed once at construction.
+*/
+template <typename FieldElementT>
+class BoundaryCompositionPolynomial : public CompositionPolynomial {
+ public:
+  struct ConstraintGroup {
+    FieldElementT point_x;
+    // Pairs of (column_index, coefficient).
+    std::vector<std::pair<size_t, FieldElementT>> terms;
+    // \sum c_i * y_i over the constraints of the group.
+    FieldElementT constant;
+  };
+
+  BoundaryCompositionPolynomial(
+      const FieldElementT& trace_generator, uint64_t coset_size, uint64_t degree_bound,
+      std::vector<ConstraintGroup> groups);
+
+  FieldElement EvalAtPoint(
+      const FieldElement& point, const ConstFieldElementSpan& neighbors) const override;
+
+  FieldElementT EvalAtPoint(
+      const FieldElementT& point, gsl::span<const FieldElementT> neighbors) const;
+
+  void EvalOnCosetBitReversedOutput(
+      const FieldElement& coset_offset, gsl::span<const ConstFieldElementSpan> trace_lde,
+      const FieldElementSpan& out_evaluation, uint64_t task_size) const override;
+
+  void EvalOnCosetBitReversedOutput(
+      const FieldElementT& coset_offset, gsl::span<const gsl::span<const FieldElementT>> trace_lde,
+      gsl::span<FieldElementT> out_evaluation, uint64_t task_size) const;
+
+  /*
+    The mask of BoundaryAir consists of the current row only, so the columns can be consumed in the
+    order in which the LDE manager produces them.
+  */
+  bool SupportsBitReversedInput() const override { return true; }
+
+  void EvalOnCosetBitReversedInputAndOutput(
+      const FieldElement& coset_offset, gsl::span<const ConstFieldElementSpan> trace_lde,
+      const FieldElementSpan& out_evaluation, uint64_t task_size) const override;
+
+  uint64_t GetDegreeBound() const override { return degree_bound_; }
+
+ private:
+  /*
+    Returns the points of the coset coset_offset*<trace_generator_>, in natural or in bit reversed
+    order.
+  */
+  std::vector<FieldElementT> CosetPoints(
+      const FieldElementT& coset_offset, bool bit_reversed, uint64_t task_size) const;
+
+  /*
+    Evaluates the polynomial on points, where trace_lde[j][i] is the value of column j at points[i].
+    The value at points[i] is written to out_evaluation[BitReverse(i)] if bit_reverse_output is
+    true, and to out_evaluation[i] otherwise.
+  */
+  void EvalOnPoints(
+      gsl::span<const FieldElementT> points,
+      gsl::span<const gsl::span<const FieldElementT>> trace_lde,
+      gsl::span<FieldElementT> out_evaluation, bool bit_reverse_output, uint64_t task_size) const;
+
+  FieldElementT trace_generator_;
+  uint64_t coset_size_;
+  uint64_t degree_bound_;
+  std::vector<ConstraintGroup> groups_;
+};
+
+}  // namespace starkware
+
+#include "starkware/air/boundary/boundary_composition_polynomial.inl"
+
+#endif  // STARKWARE_AIR_BOUNDARY_BOUNDARY_COMPOSITION_POLYNOMIAL_H_
@@ -0,0 +1,228 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include <algorithm>
+
+#include "starkware/algebra/field_operations.h"
+#include "starkware/algebra/fields/fraction_field_element.h"
+#include "starkware/error_handling/error_handling.h"
+#include "starkware/math/math.h"
+#include "starkware/utils/bit_reversal.h"
+#include "starkware/utils/task_manager.h"
+
+namespace starkware {
+
+namespace boundary_composition_polynomial {
+namespace details {
+
+/*
+  Pre-allocated buffers of a single worker, each of the size of a task.
+*/
+template <typename FieldElementT>
+struct WorkerMemory {
+  explicit WorkerMemory(size_t task_size)
+      : group_sums(FieldElementT::UninitializedVector(task_size)),
+        numerators(FieldElementT::UninitializedVector(task_size)),
+        denominators(FieldElementT::UninitializedVector(task_size)),
+        denominators_inv(FieldElementT::UninitializedVector(task_size)) {}
+
+  std::vector<FieldElementT> group_sums;
+  std::vector<FieldElementT> numerators;
+  std::vector<FieldElementT> denominators;
+  std::vector<FieldElementT> denominators_inv;
+};
+
+}  // namespace details
+}  // namespace boundary_composition_polynomial
+
+template <typename FieldElementT>
+BoundaryCompositionPolynomial<FieldElementT>::BoundaryCompositionPolynomial(
+    const FieldElementT& trace_generator, uint64_t coset_size, uint64_t degree_bound,
+    std::vector<ConstraintGroup> groups)
+    : trace_generator_(trace_generator),
+      coset_size_(coset_size),
+      degree_bound_(degree_bound),
+      groups_(std::move(groups)) {
+  ASSERT_RELEASE(!groups_.empty(), "BoundaryCompositionPolynomial must have constraints.");
+  for (const ConstraintGroup& group : groups_) {
+    ASSERT_RELEASE(!group.terms.empty(), "Empty constraint group.");
+  }
+}
+
+template <typename FieldElementT>
+FieldElement BoundaryCompositionPolynomial<FieldElementT>::EvalAtPoint(
+    const FieldElement& point, const ConstFieldElementSpan& neighbors) const {
+  return FieldElement(EvalAtPoint(point.As<FieldElementT>(), neighbors.As<FieldElementT>()));
+}
+
+template <typename FieldElementT>
+FieldElementT BoundaryCompositionPolynomial<FieldElementT>::EvalAtPoint(
+    const FieldElementT& point, gsl::span<const FieldElementT> neighbors) const {
+  FractionFieldElement<FieldElementT> sum(FieldElementT::Zero());
+  for (const ConstraintGroup& group : groups_) {
+    FieldElementT group_sum = -group.constant;
+    for (const auto& [column_index, coefficient] : group.terms) {
+      group_sum += coefficient * neighbors[column_index];
+    }
+    sum += FractionFieldElement<FieldElementT>(group_sum, point - group.point_x);
+  }
+  return sum.ToBaseFieldElement();
+}
+
+template <typename FieldElementT>
+void BoundaryCompositionPolynomial<FieldElementT>::EvalOnCosetBitReversedOutput(
+    const FieldElement& coset_offset, gsl::span<const ConstFieldElementSpan> trace_lde,
+    const FieldElementSpan& out_evaluation, uint64_t task_size) const {
+  std::vector<gsl::span<const FieldElementT>> trace_spans;
+  trace_spans.reserve(trace_lde.size());
+  for (const ConstFieldElementSpan& span : trace_lde) {
+    trace_spans.push_back(span.As<FieldElementT>());
+  }
+
+  EvalOnCosetBitReversedOutput(
+      coset_offset.As<FieldElementT>(), trace_spans, out_evaluation.As<FieldElementT>(), task_size);
+}
+
+template <typename FieldElementT>
+void BoundaryCompositionPolynomial<FieldElementT>::EvalOnCosetBitReversedOutput(
+    const FieldElementT& coset_offset, gsl::span<const gsl::span<const FieldElementT>> trace_lde,
+    gsl::span<FieldElementT> out_evaluation, uint64_t task_size) const {
+  const std::vector<FieldElementT> points = CosetPoints(coset_offset, false, task_size);
+  EvalOnPoints(points, trace_lde, out_evaluation, true, task_size);
+}
+
+template <typename FieldElementT>
+void BoundaryCompositionPolynomial<FieldElementT>::EvalOnCosetBitReversedInputAndOutput(
+    const FieldElement& coset_offset, gsl::span<const ConstFieldElementSpan> trace_lde,
+    const FieldElementSpan& out_evaluation, uint64_t task_size) const {
+  std::vector<gsl::span<const FieldElementT>> trace_spans;
+  trace_spans.reserve(trace_lde.size());
+  for (const ConstFieldElementSpan& span : trace_lde) {
+    trace_spans.push_back(span.As<FieldElementT>());
+  }
+
+  // Both the input and the output are in bit reversed order, so only the points are reordered.
+  const std::vector<FieldElementT> points =
+      CosetPoints(coset_offset.As<FieldElementT>(), true, task_size);
+  EvalOnPoints(points, trace_spans, out_evaluation.As<FieldElementT>(), false, task_size);
+}
+
+template <typename FieldElementT>
+std::vector<FieldElementT> BoundaryCompositionPolynomial<FieldElementT>::CosetPoints(
+    const FieldElementT& coset_offset, bool bit_reversed, uint64_t task_size) const {
+  const size_t log_coset_size = SafeLog2(coset_size_);
+  std::vector<FieldElementT> points = FieldElementT::UninitializedVector(coset_size_);
+  const FieldElementT point_multiplier = Pow(trace_generator_, task_size);
+  std::vector<FieldElementT> algebraic_offsets;
+  algebraic_offsets.reserve(DivCeil(coset_size_, task_size));
+  FieldElementT point = coset_offset;
+  for (uint64_t task_idx_offset = 0; task_idx_offset < coset_size_; task_idx_offset += task_size) {
+    algebraic_offsets.push_back(point);
+    point *= point_multiplier;
+  }
+
+  TaskManager::GetInstance().ParallelFor(
+      algebraic_offsets.size(),
+      [this, &points, &algebraic_offsets, bit_reversed, log_coset_size,
+       task_size](const TaskInfo& task_info) {
+        const uint64_t initial_point_idx = task_size * task_info.start_idx;
+        const uint64_t end_idx = std::min(initial_point_idx + task_size, coset_size_);
+        FieldElementT point = algebraic_offsets[task_info.start_idx];
+        for (uint64_t i = initial_point_idx; i < end_idx; ++i) {
+          points[bit_reversed ? BitReverse(i, log_coset_size) : i] = point;
+          point *= trace_generator_;
+        }
+      });
+  return points;
+}
+
+template <typename FieldElementT>
+void BoundaryCompositionPolynomial<FieldElementT>::EvalOnPoints(
+    gsl::span<const FieldElementT> points,
+    gsl::span<const gsl::span<const FieldElementT>> trace_lde,
+    gsl::span<FieldElementT> out_evaluation, bool bit_reverse_output, uint64_t task_size) const {
+  const size_t log_coset_size = SafeLog2(coset_size_);
+  ASSERT_RELEASE(
+      out_evaluation.size() == coset_size_,
+      "Output span size does not match coset size: " + std::to_string(out_evaluation.size()) +
+          " != " + std::to_string(coset_size_));
+  ASSERT_RELEASE(points.size() == coset_size_, "Wrong number of points.");
+  for (const auto& column : trace_lde) {
+    ASSERT_RELEASE(column.size() == coset_size_, "Trace column is not of expected length.");
+  }
+
+  TaskManager& task_manager = TaskManager::GetInstance();
+  using WorkerMemoryT = boundary_composition_polynomial::details::WorkerMemory<FieldElementT>;
+  std::vector<WorkerMemoryT> worker_mem;
+  worker_mem.reserve(task_manager.GetNumThreads());
+  for (size_t i = 0; i < task_manager.GetNumThreads(); ++i) {
+    worker_mem.emplace_back(task_size);
+  }
+
+  task_manager.ParallelFor(
+      DivCeil(coset_size_, task_size),
+      [this, &worker_mem, points, trace_lde, out_evaluation, bit_reverse_output, log_coset_size,
+       task_size](const TaskInfo& task_info) {
+        const uint64_t initial_point_idx = task_size * task_info.start_idx;
+        const size_t actual_task_size = std::min(task_size, coset_size_ - initial_point_idx);
+        WorkerMemoryT& wm = worker_mem[TaskManager::GetWorkerId()];
+        const auto task_points = points.subspan(initial_point_idx, actual_task_size);
+        const auto group_sums = gsl::make_span(wm.group_sums).first(actual_task_size);
+        const auto numerators = gsl::make_span(wm.numerators).first(actual_task_size);
+        const auto denominators = gsl::make_span(wm.denominators).first(actual_task_size);
+        const auto denominators_inv = gsl::make_span(wm.denominators_inv).first(actual_task_size);
+
+        for (size_t group_idx = 0; group_idx < groups_.size(); ++group_idx) {
+          const ConstraintGroup& group = groups_[group_idx];
+
+          // Accumulate the columns of the group, one column at a time.
+          const auto& [first_column, first_coefficient] = group.terms[0];
+          const auto first_values = trace_lde[first_column].subspan(initial_point_idx);
+          for (size_t i = 0; i < actual_task_size; ++i) {
+            group_sums[i] = first_coefficient * first_values[i];
+          }
+          for (size_t term_idx = 1; term_idx < group.terms.size(); ++term_idx) {
+            const auto& [column_index, coefficient] = group.terms[term_idx];
+            const auto values = trace_lde[column_index].subspan(initial_point_idx);
+            for (size_t i = 0; i < actual_task_size; ++i) {
+              group_sums[i] += coefficient * values[i];
+            }
+          }
+
+          // Add group_sum / (x - x_k) to numerator / denominator.
+          if (group_idx == 0) {
+            for (size_t i = 0; i < actual_task_size; ++i) {
+              numerators[i] = group_sums[i] - group.constant;
+              denominators[i] = task_points[i] - group.point_x;
+            }
+          } else {
+            for (size_t i = 0; i < actual_task_size; ++i) {
+              const FieldElementT denominator = task_points[i] - group.point_x;
+              numerators[i] =
+                  numerators[i] * denominator + (group_sums[i] - group.constant) * denominators[i];
+              denominators[i] *= denominator;
+            }
+          }
+        }
+
+        BatchInverse<FieldElementT>(denominators, denominators_inv);
+        for (size_t i = 0; i < actual_task_size; ++i) {
+          const uint64_t point_idx = initial_point_idx + i;
+          out_evaluation[bit_reverse_output ? BitReverse(point_idx, log_coset_size) : point_idx] =
+              numerators[i] * denominators_inv[i];
+        }
+      });
+}
+
+}  // namespace starkware
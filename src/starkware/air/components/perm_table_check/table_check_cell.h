@@ -76,7 +76,9 @@ class TableCheckCell {
 
  protected:
   std::vector<uint64_t> values_;
-  std::vector<bool> is_initialized_;
+  // Not std::vector<bool>, so that Get() may be called without the lock while other threads write
+  // other indices.
+  std::vector<uint8_t> is_initialized_;
 };
 
 template <typename FieldElementT>
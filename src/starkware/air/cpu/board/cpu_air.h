@@ -16,6 +16,7 @@
 #define STARKWARE_AIR_CPU_BOARD_CPU_AIR_H_
 
 #include <algorithm>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -158,14 +158,20 @@ std::pair<CpuAirProverContext1<FieldElementT>, Trace> CpuAir<FieldElementT, Layo
   // Write public memory in trace.
   WritePublicMemory(&memory_pool, trace_spans);
 
+  // The builtins write to disjoint cells of the trace, and the pools they share are thread safe.
+  // Hence, they are executed concurrently (in addition to the parallelism within each builtin).
+  std::vector<std::function<void()>> builtin_tasks;
+
   // Pedersen builtin.
   if constexpr (CpuAir::kHasPedersenBuiltin) {  // NOLINT: clang-tidy if constexpr bug.
-    ProfilingBlock pedersen_builtin_block("Pedersen builtin");
-    HashBuiltinProverContext<FieldElementT>(
-        "pedersen", ctx_, hash_factory_, &memory_pool, this->pedersen_begin_addr_,
-        SafeDiv(n_steps_, PedersenRatio()), CpuAir::kPedersenBuiltinRepetitions,
-        HashBuiltinProverContext<FieldElementT>::ParsePrivateInput(private_input["pedersen"]))
-        .WriteTrace(trace_spans);
+    builtin_tasks.emplace_back([&]() {
+      ProfilingBlock pedersen_builtin_block("Pedersen builtin");
+      HashBuiltinProverContext<FieldElementT>(
+          "pedersen", ctx_, hash_factory_, &memory_pool, this->pedersen_begin_addr_,
+          SafeDiv(n_steps_, PedersenRatio()), CpuAir::kPedersenBuiltinRepetitions,
+          HashBuiltinProverContext<FieldElementT>::ParsePrivateInput(private_input["pedersen"]))
+          .WriteTrace(trace_spans);
+    });
   }
 
   // Range check builtin.
@@ -177,20 +183,24 @@ std::pair<CpuAirProverContext1<FieldElementT>, Trace> CpuAir<FieldElementT, Layo
         RangeCheckBuiltinProverContext<FieldElementT>::ParsePrivateInput(
             private_input["range_check"]));
 
-    ProfilingBlock range_check_builtin_block("Range check builtin");
-    rc_prover->WriteTrace(trace_spans);
+    builtin_tasks.emplace_back([&]() {
+      ProfilingBlock range_check_builtin_block("Range check builtin");
+      rc_prover->WriteTrace(trace_spans);
+    });
   }
 
   // ECDSA builtin.
   if constexpr (CpuAir::kHasEcdsaBuiltin) {  // NOLINT: clang-tidy if constexpr bug.
-    ProfilingBlock ecdsa_builtin_block("ECDSA builtin");
-    SignatureBuiltinProverContext<FieldElementT>(
-        "ecdsa", ctx_, &memory_pool, this->ecdsa_begin_addr_, CpuAir::kEcdsaElementHeight,
-        CpuAir::kEcdsaElementBits, SafeDiv(n_steps_, EcdsaRatio()),
-        CpuAir::kEcdsaBuiltinRepetitions, this->ecdsa__sig_config_,
-        SignatureBuiltinProverContext<FieldElementT>::ParsePrivateInput(
-            private_input["ecdsa"], this->ecdsa__sig_config_))
-        .WriteTrace(trace_spans);
+    builtin_tasks.emplace_back([&]() {
+      ProfilingBlock ecdsa_builtin_block("ECDSA builtin");
+      SignatureBuiltinProverContext<FieldElementT>(
+          "ecdsa", ctx_, &memory_pool, this->ecdsa_begin_addr_, CpuAir::kEcdsaElementHeight,
+          CpuAir::kEcdsaElementBits, SafeDiv(n_steps_, EcdsaRatio()),
+          CpuAir::kEcdsaBuiltinRepetitions, this->ecdsa__sig_config_,
+          SignatureBuiltinProverContext<FieldElementT>::ParsePrivateInput(
+              private_input["ecdsa"], this->ecdsa__sig_config_))
+          .WriteTrace(trace_spans);
+    });
   }
 
   std::optional<diluted_check_cell::DilutedCheckCell<FieldElementT>> diluted_pool;
@@ -201,59 +211,71 @@ std::pair<CpuAirProverContext1<FieldElementT>, Trace> CpuAir<FieldElementT, Layo
 
   // Bitwise builtin.
   if constexpr (CpuAir::kHasBitwiseBuiltin) {  // NOLINT: clang-tidy if constexpr bug.
-    ProfilingBlock bitwise_builtin_block("Bitwise builtin");
-    BitwiseBuiltinProverContext<FieldElementT>(
-        "bitwise", ctx_, &memory_pool, &*diluted_pool, this->bitwise_begin_addr_,
-        SafeDiv(n_steps_, BitwiseRatio()), CpuAir::kDilutedSpacing, CpuAir::kDilutedNBits,
-        CpuAir::kBitwiseTotalNBits,
-        BitwiseBuiltinProverContext<FieldElementT>::ParsePrivateInput(private_input["bitwise"]))
-        .WriteTrace(trace_spans);
+    builtin_tasks.emplace_back([&]() {
+      ProfilingBlock bitwise_builtin_block("Bitwise builtin");
+      BitwiseBuiltinProverContext<FieldElementT>(
+          "bitwise", ctx_, &memory_pool, &*diluted_pool, this->bitwise_begin_addr_,
+          SafeDiv(n_steps_, BitwiseRatio()), CpuAir::kDilutedSpacing, CpuAir::kDilutedNBits,
+          CpuAir::kBitwiseTotalNBits,
+          BitwiseBuiltinProverContext<FieldElementT>::ParsePrivateInput(private_input["bitwise"]))
+          .WriteTrace(trace_spans);
+    });
   }
 
   // EcOp builtin.
   if constexpr (CpuAir::kHasEcOpBuiltin) {  // NOLINT: clang-tidy if constexpr bug.
-    ProfilingBlock ec_op_builtin_block("EC operation builtin");
-    EcOpBuiltinProverContext<FieldElementT>(
-        /*name=*/"ec_op",
-        /*ctx=*/ctx_,
-        /*memory_pool=*/&memory_pool,
-        /*begin_addr=*/this->ec_op_begin_addr_,
-        /*height=*/CpuAir::kEcOpScalarHeight,
-        /*n_bits=*/CpuAir::kEcOpNBits, SafeDiv(n_steps_, EcOpRatio()),
-        /*curve_config=*/this->ec_op__curve_config_,
-        /*inputs=*/
-        EcOpBuiltinProverContext<FieldElementT>::ParsePrivateInput(private_input["ec_op"]))
-        .WriteTrace(trace_spans);
+    builtin_tasks.emplace_back([&]() {
+      ProfilingBlock ec_op_builtin_block("EC operation builtin");
+      EcOpBuiltinProverContext<FieldElementT>(
+          /*name=*/"ec_op",
+          /*ctx=*/ctx_,
+          /*memory_pool=*/&memory_pool,
+          /*begin_addr=*/this->ec_op_begin_addr_,
+          /*height=*/CpuAir::kEcOpScalarHeight,
+          /*n_bits=*/CpuAir::kEcOpNBits, SafeDiv(n_steps_, EcOpRatio()),
+          /*curve_config=*/this->ec_op__curve_config_,
+          /*inputs=*/
+          EcOpBuiltinProverContext<FieldElementT>::ParsePrivateInput(private_input["ec_op"]))
+          .WriteTrace(trace_spans);
+    });
   }
 
   // Keccak builtin.
   if constexpr (CpuAir::kHasKeccakBuiltin) {  // NOLINT: clang-tidy if constexpr bug.
-    ProfilingBlock keccak_builtin_block("Keccak builtin");
-    KeccakBuiltinProverContext<FieldElementT>(
-        "keccak", ctx_, &memory_pool, &*diluted_pool, this->keccak_begin_addr_,
-        SafeDiv(n_steps_, CpuAir::kKeccakRatio * CpuAir::kDilutedNBits), CpuAir::kDilutedSpacing,
-        CpuAir::kDilutedNBits,
-        KeccakBuiltinProverContext<FieldElementT>::ParsePrivateInput(private_input["keccak"]))
-        .WriteTrace(trace_spans);
+    builtin_tasks.emplace_back([&]() {
+      ProfilingBlock keccak_builtin_block("Keccak builtin");
+      KeccakBuiltinProverContext<FieldElementT>(
+          "keccak", ctx_, &memory_pool, &*diluted_pool, this->keccak_begin_addr_,
+          SafeDiv(n_steps_, CpuAir::kKeccakRatio * CpuAir::kDilutedNBits),
+          CpuAir::kDilutedSpacing, CpuAir::kDilutedNBits,
+          KeccakBuiltinProverContext<FieldElementT>::ParsePrivateInput(private_input["keccak"]))
+          .WriteTrace(trace_spans);
+    });
   }
 
   // Poseidon builtin.
   if constexpr (CpuAir::kHasPoseidonBuiltin) {  // NOLINT: clang-tidy if constexpr bug.
-    ProfilingBlock poseidon_builtin_block("Poseidon builtin");
-    const ConstSpanAdapter<FieldElementT> mds_spans{
-        gsl::span<const std::array<FieldElementT, CpuAir::kPoseidonM>>{CpuAir::kPoseidonMds}};
-    const ConstSpanAdapter<FieldElementT> ark_spans{
-        gsl::span<const std::array<FieldElementT, CpuAir::kPoseidonM>>{CpuAir::kPoseidonArk}};
-    PoseidonBuiltinProverContext<FieldElementT, CpuAir::kPoseidonM>(
-        "poseidon", ctx_, &memory_pool, this->poseidon_begin_addr_,
-        SafeDiv(n_steps_, CpuAir::kPoseidonRatio),
-        PoseidonBuiltinProverContext<FieldElementT, CpuAir::kPoseidonM>::ParsePrivateInput(
-            private_input["poseidon"]),
-        CpuAir::kPoseidonRoundsFull, CpuAir::kPoseidonRoundsPartial, CpuAir::kPoseidonRPPartition,
-        mds_spans, ark_spans)
-        .WriteTrace(trace_spans);
+    builtin_tasks.emplace_back([&]() {
+      ProfilingBlock poseidon_builtin_block("Poseidon builtin");
+      const ConstSpanAdapter<FieldElementT> mds_spans{
+          gsl::span<const std::array<FieldElementT, CpuAir::kPoseidonM>>{CpuAir::kPoseidonMds}};
+      const ConstSpanAdapter<FieldElementT> ark_spans{
+          gsl::span<const std::array<FieldElementT, CpuAir::kPoseidonM>>{CpuAir::kPoseidonArk}};
+      PoseidonBuiltinProverContext<FieldElementT, CpuAir::kPoseidonM>(
+          "poseidon", ctx_, &memory_pool, this->poseidon_begin_addr_,
+          SafeDiv(n_steps_, CpuAir::kPoseidonRatio),
+          PoseidonBuiltinProverContext<FieldElementT, CpuAir::kPoseidonM>::ParsePrivateInput(
+              private_input["poseidon"]),
+          CpuAir::kPoseidonRoundsFull, CpuAir::kPoseidonRoundsPartial,
+          CpuAir::kPoseidonRPPartition, mds_spans, ark_spans)
+          .WriteTrace(trace_spans);
+    });
   }
 
+  TaskManager::GetInstance().ParallelFor(builtin_tasks.size(), [&](const TaskInfo& task_info) {
+    builtin_tasks[task_info.start_idx]();
+  });
+
   // Finalize.
   rc16_pool.Finalize(rc_min_, rc_max_, trace_spans);
   if (rc_prover.has_value()) {
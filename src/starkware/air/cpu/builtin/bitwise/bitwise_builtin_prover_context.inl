@@ -60,7 +60,8 @@ void BitwiseBuiltinProverContext<FieldElementT>::WriteTrace(
     mask |= Pow2(bit * diluted_spacing_);
   }
 
-  for (size_t i = 0; i < n_instances_; ++i) {
+  TaskManager::GetInstance().ParallelFor(n_instances_, [&](const TaskInfo& task_info) {
+    const size_t i = task_info.start_idx;
     const auto& input_itr = inputs_.find(i);
     const Input& input = input_itr == inputs_.end() ? Input{0x0_Z, 0x0_Z} : input_itr->second;
     const uint64_t mem_addr = begin_addr_ + 5 * i;
@@ -89,7 +90,7 @@ void BitwiseBuiltinProverContext<FieldElementT>::WriteTrace(
       diluted_value <<= delta;
       cell_view.WriteTrace(i, diluted_value, trace);
     }
-  }
+  });
 }
 
 template <typename FieldElementT>
@@ -23,7 +23,8 @@ void EcOpBuiltinProverContext<FieldElementT>::WriteTrace(
   const Input dummy_input{kPrimeFieldEc0.k_points[0], kPrimeFieldEc0.k_points[1],
                           FieldElementT::FromUint(0)};
 
-  for (uint64_t idx = 0; idx < n_instances_; ++idx) {
+  TaskManager::GetInstance().ParallelFor(n_instances_, [&](const TaskInfo& task_info) {
+    const uint64_t idx = task_info.start_idx;
     const uint64_t mem_addr = begin_addr_ + 7 * idx;
 
     std::vector<FieldElementT> slopes = FieldElementT::UninitializedVector(height_ - 1);
@@ -56,7 +57,7 @@ void EcOpBuiltinProverContext<FieldElementT>::WriteTrace(
     mem_m_.WriteTrace(idx, mem_addr + 4, input.m, trace);
     mem_r_x_.WriteTrace(idx, mem_addr + 5, output.x, trace);
     mem_r_y_.WriteTrace(idx, mem_addr + 6, output.y, trace);
-  }
+  });
 }
 
 template <typename FieldElementT>
@@ -21,7 +21,8 @@ namespace cpu {
 template <typename FieldElementT>
 void KeccakBuiltinProverContext<FieldElementT>::WriteTrace(
     gsl::span<const gsl::span<FieldElementT>> trace) const {
-  for (size_t i = 0; i < n_component_instances_; ++i) {
+  TaskManager::GetInstance().ParallelFor(n_component_instances_, [&](const TaskInfo& task_info) {
+    const size_t i = task_info.start_idx;
     constexpr size_t kPaddingSize =
         FieldElementT::SizeInBytes() - KeccakComponent<FieldElementT>::kBytesInWord;
     // The current_witness is padded with kPaddingSize to simplify FieldElementT::ToBytes() usage.
@@ -57,7 +58,7 @@ void KeccakBuiltinProverContext<FieldElementT>::WriteTrace(
             io[index + kInputOutputLength * idx_in_batch], trace);
       }
     }
-  }
+  });
 }
 
 template <typename FieldElementT>
@@ -21,7 +21,8 @@ namespace cpu {
 template <typename FieldElementT, size_t M>
 void PoseidonBuiltinProverContext<FieldElementT, M>::WriteTrace(
     gsl::span<const gsl::span<FieldElementT>> trace) const {
-  for (size_t i = 0; i < n_component_instances_; ++i) {
+  TaskManager::GetInstance().ParallelFor(n_component_instances_, [&](const TaskInfo& task_info) {
+    const size_t i = task_info.start_idx;
     const auto& input_itr = inputs_.find(i);
     const Input& input = input_itr == inputs_.end() ? ZeroInput() : input_itr->second;
 
@@ -38,7 +39,7 @@ void PoseidonBuiltinProverContext<FieldElementT, M>::WriteTrace(
       mem_input_output_.WriteTrace(
           M + index + 2 * kMCapacity * i, mem_addr + M + index, output[index], trace);
     }
-  }
+  });
 }
 
 template <typename FieldElementT, size_t M>
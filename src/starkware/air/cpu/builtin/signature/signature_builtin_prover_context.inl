@@ -36,7 +36,8 @@ void SignatureBuiltinProverContext<FieldElementT>::WriteTrace(
     gsl::span<const gsl::span<FieldElementT>> trace) const {
   const SigInputT dummy_input(GetDummySignature());
 
-  for (uint64_t idx = 0; idx < n_instances_; ++idx) {
+  TaskManager::GetInstance().ParallelFor(n_instances_, [&](const TaskInfo& task_info) {
+    const uint64_t idx = task_info.start_idx;
     const uint64_t mem_addr = begin_addr_ + 2 * idx;
 
     const auto& input_itr = inputs_.find(idx);
@@ -45,7 +46,7 @@ void SignatureBuiltinProverContext<FieldElementT>::WriteTrace(
 
     mem_pubkey_.WriteTrace(idx, mem_addr, input.public_key.x, trace);
     mem_message_.WriteTrace(idx, mem_addr + 1, input.z, trace);
-  }
+  });
 }
 
 template <typename FieldElementT>
@@ -0,0 +1,97 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+/*
+  Quasi-linear polynomial arithmetic on top of the multiplicative FFT.
+
+  All polynomials are given by their coefficients in natural order, where the first coefficient is
+  the free coefficient (the same convention as in starkware/algebra/polynomials.h).
+  Multiplication uses the FFT whenever the field has a multiplicative subgroup of the required size
+  and the inputs are large enough, and falls back to schoolbook multiplication otherwise. The other
+  functions are built on top of multiplication, so they are correct for every field.
+*/
+
+#ifndef STARKWARE_ALGEBRA_FFT_FAST_POLYNOMIALS_H_
+#define STARKWARE_ALGEBRA_FFT_FAST_POLYNOMIALS_H_
+
+#include <utility>
+#include <vector>
+
+#include "third_party/gsl/gsl-lite.hpp"
+
+#include "starkware/math/math.h"
+
+namespace starkware {
+
+/*
+  Returns the product of the polynomials a and b.
+*/
+template <typename FieldElementT>
+std::vector<FieldElementT> PolynomialMultiply(
+    gsl::span<const FieldElementT> a, gsl::span<const FieldElementT> b);
+
+/*
+  Returns g such that f * g = 1 (mod x^n), using Newton iteration. f[0] must be non-zero.
+*/
+template <typename FieldElementT>
+std::vector<FieldElementT> PolynomialInverseModXn(gsl::span<const FieldElementT> f, size_t n);
+
+/*
+  Returns (q, r) such that a = q * b + r and deg(r) < deg(b). The leading coefficient of b (i.e.,
+  b.back()) must be non-zero. r is returned with exactly b.size() - 1 coefficients and q with
+  max(a.size() - b.size() + 1, 0) coefficients.
+*/
+template <typename FieldElementT>
+std::pair<std::vector<FieldElementT>, std::vector<FieldElementT>> PolynomialDivRem(
+    gsl::span<const FieldElementT> a, gsl::span<const FieldElementT> b);
+
+/*
+  Evaluates the polynomial with the given coefficients at all the given points, using a subproduct
+  tree. The complexity is O(M(n) + M(m) * log(m)) where n = coefs.size(), m = points.size() and
+  M(k) is the complexity of multiplying two polynomials of degree k.
+*/
+template <typename FieldElementT>
+void FastMultipointEval(
+    gsl::span<const FieldElementT> points, gsl::span<const FieldElementT> coefs,
+    gsl::span<FieldElementT> outputs);
+
+/*
+  Same as LagrangeInterpolation() (see polynomials.h), using a subproduct tree. The complexity is
+  O(M(n) * log(n)). The points in the domain must be distinct.
+*/
+template <typename FieldElementT>
+std::vector<FieldElementT> FastInterpolation(
+    gsl::span<const FieldElementT> domain, gsl::span<const FieldElementT> values);
+
+/*
+  Returns true if FastMultipointEval() is expected to be faster than Horner evaluation for a
+  polynomial with n_coefs coefficients and n_points points.
+*/
+template <typename FieldElementT>
+bool ShouldUseFastMultipointEval(size_t n_coefs, size_t n_points);
+
+/*
+  Evaluates the polynomial with the given coefficients at all the given points, choosing between
+  OptimizedBatchHornerEval() and FastMultipointEval() according to ShouldUseFastMultipointEval().
+*/
+template <typename FieldElementT>
+void MultipointEval(
+    gsl::span<const FieldElementT> points, gsl::span<const FieldElementT> coefs,
+    gsl::span<FieldElementT> outputs);
+
+}  // namespace starkware
+
+#include "starkware/algebra/fft/fast_polynomials.inl"
+
+#endif  // STARKWARE_ALGEBRA_FFT_FAST_POLYNOMIALS_H_
@@ -0,0 +1,437 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include <algorithm>
+
+#include "starkware/algebra/fft/multiplicative_fft.h"
+#include "starkware/algebra/field_operations.h"
+#include "starkware/algebra/polynomials.h"
+#include "starkware/error_handling/error_handling.h"
+#include "starkware/fft_utils/fft_bases.h"
+#include "starkware/utils/task_manager.h"
+
+namespace starkware {
+
+namespace fast_polynomials {
+namespace details {
+
+/*
+  Polynomials with fewer coefficients than this are multiplied using the schoolbook method.
+*/
+constexpr size_t kSchoolbookThreshold = 64;
+
+/*
+  The number of points in each leaf of the subproduct tree. Below this size, Horner evaluation
+  is faster than further descending the tree.
+*/
+constexpr size_t kLeafSize = 32;
+
+/*
+  The cost of FastMultipointEval() for n coefficients and m points is estimated (in units of a
+  single Horner step) as:
+    kFastEvalReductionFactor * n * log(m) + kFastEvalTreeFactor * m * log(m)^2.
+  The first term is the reduction of the polynomial modulo the root of the subproduct tree and the
+  second is building and descending the tree. The constants were found empirically through
+  benchmarking.
+*/
+constexpr size_t kMinFastEvalPoints = 64;
+constexpr uint64_t kFastEvalReductionFactor = 10;
+constexpr uint64_t kFastEvalTreeFactor = 16;
+
+/*
+  Returns true if the field has a multiplicative subgroup of size n.
+*/
+template <typename FieldElementT>
+bool HasSubGroupOfSize(uint64_t n) {
+  using IntType = decltype(FieldElementT::FieldSize());
+  const auto [quotient, remainder] =
+      IntType::Div(IntType::Sub(FieldElementT::FieldSize(), IntType::One()).first, IntType(n));
+  (void)quotient;
+  return remainder == IntType::Zero();
+}
+
+template <typename FieldElementT>
+std::vector<FieldElementT> SchoolbookMultiply(
+    gsl::span<const FieldElementT> a, gsl::span<const FieldElementT> b) {
+  std::vector<FieldElementT> res(a.size() + b.size() - 1, FieldElementT::Zero());
+  for (size_t i = 0; i < a.size(); ++i) {
+    for (size_t j = 0; j < b.size(); ++j) {
+      res[i + j] += a[i] * b[j];
+    }
+  }
+  return res;
+}
+
+/*
+  Multiplies a and b by evaluating both on a multiplicative subgroup <w> of size
+  n >= a.size() + b.size() - 1, multiplying pointwise and interpolating.
+  The forward transforms use bases in bit-reversed order, so they consume the coefficients in
+  natural order and produce the evaluations in bit-reversed order. Interpolation is done by a
+  forward transform over <w^-1> with bases in natural order, which consumes the evaluations in
+  bit-reversed order and produces the coefficients (times n) in natural order. Hence, no bit
+  reversal of the data is required.
+*/
+template <typename FieldElementT>
+std::vector<FieldElementT> FftMultiply(
+    gsl::span<const FieldElementT> a, gsl::span<const FieldElementT> b) {
+  const size_t res_size = a.size() + b.size() - 1;
+  const size_t log_n = Log2Ceil(res_size);
+  const size_t n = Pow2(log_n);
+  const FieldElementT generator = GetSubGroupGenerator<FieldElementT>(n);
+  const auto bases = MakeFftBases<MultiplicativeGroupOrdering::kBitReversedOrder>(
+      generator, log_n, FieldElementT::One());
+  const auto inverse_bases = MakeFftBases<MultiplicativeGroupOrdering::kNaturalOrder>(
+      Pow(generator, n - 1), log_n, FieldElementT::One());
+
+  std::vector<FieldElementT> buffer(n, FieldElementT::Zero());
+  std::vector<FieldElementT> a_evals = FieldElementT::UninitializedVector(n);
+  std::vector<FieldElementT> b_evals = FieldElementT::UninitializedVector(n);
+
+  std::copy(a.begin(), a.end(), buffer.begin());
+  MultiplicativeFft(bases, buffer, a_evals);
+  std::fill(buffer.begin(), buffer.end(), FieldElementT::Zero());
+  std::copy(b.begin(), b.end(), buffer.begin());
+  MultiplicativeFft(bases, buffer, b_evals);
+
+  for (size_t i = 0; i < n; ++i) {
+    a_evals[i] *= b_evals[i];
+  }
+  MultiplicativeFft(inverse_bases, a_evals, buffer);
+
+  // The result of the inverse transform is multiplied by n.
+  static const FieldElementT kTwoInverse = FieldElementT::FromUint(2).Inverse();
+  const FieldElementT n_inv = Pow(kTwoInverse, log_n);
+  buffer.resize(res_size, FieldElementT::Zero());
+  for (FieldElementT& coef : buffer) {
+    coef *= n_inv;
+  }
+  return buffer;
+}
+
+/*
+  Same as PolynomialDivRem(), where b_rev_inverse is the inverse of the reversed b modulo x^k for
+  some k >= a.size() - b.size() + 1.
+*/
+template <typename FieldElementT>
+std::pair<std::vector<FieldElementT>, std::vector<FieldElementT>> DivRemWithReversedInverse(
+    gsl::span<const FieldElementT> a, gsl::span<const FieldElementT> b,
+    gsl::span<const FieldElementT> b_rev_inverse) {
+  const size_t b_size = b.size();
+  std::vector<FieldElementT> remainder(a.begin(), a.begin() + std::min(a.size(), b_size - 1));
+  remainder.resize(b_size - 1, FieldElementT::Zero());
+  if (a.size() < b_size) {
+    return {{}, std::move(remainder)};
+  }
+
+  // Let rev(p) denote the polynomial p with its coefficients reversed. Then
+  // rev(q) = rev(a) * rev(b)^-1 (mod x^q_size).
+  const size_t q_size = a.size() - b_size + 1;
+  ASSERT_RELEASE(b_rev_inverse.size() >= q_size, "Insufficient precision of the inverse.");
+  const std::vector<FieldElementT> a_rev(a.rbegin(), a.rbegin() + q_size);
+  std::vector<FieldElementT> quotient =
+      PolynomialMultiply<FieldElementT>(a_rev, b_rev_inverse.subspan(0, q_size));
+  quotient.resize(q_size, FieldElementT::Zero());
+  std::reverse(quotient.begin(), quotient.end());
+
+  // r = a - b * q. Only the lower b_size - 1 coefficients are non-zero.
+  const std::vector<FieldElementT> b_times_q = PolynomialMultiply<FieldElementT>(b, quotient);
+  for (size_t i = 0; i < remainder.size(); ++i) {
+    remainder[i] = remainder[i] - b_times_q[i];
+  }
+  return {std::move(quotient), std::move(remainder)};
+}
+
+/*
+  Returns a mod b, with b.size() - 1 coefficients.
+  When a is much longer than b, a is reduced in blocks of d = deg(b) coefficients, from the top:
+  r <- (r * x^d + block) mod b. This way all the multiplications are of size O(d), and the inverse
+  of the reversed b is only computed once, to precision d.
+*/
+template <typename FieldElementT>
+std::vector<FieldElementT> PolynomialMod(
+    gsl::span<const FieldElementT> a, gsl::span<const FieldElementT> b) {
+  const size_t degree = b.size() - 1;
+  if (degree == 0 || a.size() <= 2 * degree) {
+    return PolynomialDivRem<FieldElementT>(a, b).second;
+  }
+
+  const std::vector<FieldElementT> b_rev(b.rbegin(), b.rend());
+  const std::vector<FieldElementT> b_rev_inverse =
+      PolynomialInverseModXn<FieldElementT>(b_rev, degree);
+
+  // Start with the top a.size() % degree coefficients (or degree coefficients, if it divides
+  // a.size()), and fold in the lower blocks one by one.
+  size_t block_start = a.size() - ((a.size() - 1) % degree + 1);
+  std::vector<FieldElementT> remainder(a.begin() + block_start, a.end());
+  remainder.resize(degree, FieldElementT::Zero());
+  std::vector<FieldElementT> shifted = FieldElementT::UninitializedVector(2 * degree);
+  while (block_start > 0) {
+    block_start -= degree;
+    std::copy(a.begin() + block_start, a.begin() + block_start + degree, shifted.begin());
+    std::copy(remainder.begin(), remainder.end(), shifted.begin() + degree);
+    remainder = DivRemWithReversedInverse<FieldElementT>(shifted, b, b_rev_inverse).second;
+  }
+  return remainder;
+}
+
+/*
+  A subproduct tree over a set of points. tree[0] holds the leaves, where leaf i is the polynomial
+  prod_j (x - points[i * kLeafSize + j]). Each node in tree[l + 1] is the product of two adjacent
+  nodes of tree[l] (if tree[l] is of odd size, its last node is copied to tree[l + 1] as is).
+  tree.back() consists of a single node: prod_i (x - points[i]).
+*/
+template <typename FieldElementT>
+using SubproductTree = std::vector<std::vector<std::vector<FieldElementT>>>;
+
+template <typename FieldElementT>
+SubproductTree<FieldElementT> BuildSubproductTree(gsl::span<const FieldElementT> points) {
+  ASSERT_RELEASE(!points.empty(), "Cannot build a subproduct tree for an empty set of points.");
+  SubproductTree<FieldElementT> tree(1);
+  const size_t n_leaves = DivCeil(points.size(), kLeafSize);
+  tree[0].resize(n_leaves);
+  TaskManager::GetInstance().ParallelFor(n_leaves, [&](const TaskInfo& task_info) {
+    const size_t leaf_idx = task_info.start_idx;
+    const auto leaf_points = points.subspan(
+        leaf_idx * kLeafSize, std::min(kLeafSize, points.size() - leaf_idx * kLeafSize));
+    std::vector<FieldElementT>& poly = tree[0][leaf_idx];
+    poly.reserve(leaf_points.size() + 1);
+    poly.push_back(FieldElementT::One());
+    // Multiply by (x - point), using the equation:
+    // (\sum a_k * x^k)(x-d) = \sum (a_{k-1} - d*a_k) * x^k.
+    for (const FieldElementT& point : leaf_points) {
+      poly.push_back(poly.back());
+      for (size_t k = poly.size() - 2; k > 0; --k) {
+        poly[k] = poly[k - 1] - point * poly[k];
+      }
+      poly[0] = -(point * poly[0]);
+    }
+  });
+
+  while (tree.back().size() > 1) {
+    const auto& level = tree.back();
+    std::vector<std::vector<FieldElementT>> next_level(DivCeil(level.size(), 2));
+    TaskManager::GetInstance().ParallelFor(next_level.size(), [&](const TaskInfo& task_info) {
+      const size_t idx = task_info.start_idx;
+      next_level[idx] = 2 * idx + 1 < level.size()
+                            ? PolynomialMultiply<FieldElementT>(level[2 * idx], level[2 * idx + 1])
+                            : level[2 * idx];
+    });
+    tree.push_back(std::move(next_level));
+  }
+  return tree;
+}
+
+/*
+  Evaluates coefs at points, where tree is the subproduct tree of points.
+*/
+template <typename FieldElementT>
+void MultipointEvalWithTree(
+    const SubproductTree<FieldElementT>& tree, gsl::span<const FieldElementT> points,
+    gsl::span<const FieldElementT> coefs, gsl::span<FieldElementT> outputs) {
+  // Going down the tree, remainders[i] = coefs mod (the i-th node of the current level).
+  std::vector<std::vector<FieldElementT>> remainders = {
+      PolynomialMod<FieldElementT>(coefs, tree.back()[0])};
+  for (size_t level = tree.size() - 1; level-- > 0;) {
+    const auto& nodes = tree[level];
+    std::vector<std::vector<FieldElementT>> next_remainders(nodes.size());
+    TaskManager::GetInstance().ParallelFor(nodes.size(), [&](const TaskInfo& task_info) {
+      const size_t idx = task_info.start_idx;
+      next_remainders[idx] =
+          PolynomialMod<FieldElementT>(remainders[idx / 2], nodes[idx]);
+    });
+    remainders = std::move(next_remainders);
+  }
+
+  // The remainders modulo the leaves are of degree less than kLeafSize.
+  TaskManager::GetInstance().ParallelFor(remainders.size(), [&](const TaskInfo& task_info) {
+    const size_t leaf_idx = task_info.start_idx;
+    const size_t start = leaf_idx * kLeafSize;
+    const size_t size = std::min(kLeafSize, points.size() - start);
+    BatchHornerEval<FieldElementT>(
+        points.subspan(start, size), remainders[leaf_idx], outputs.subspan(start, size));
+  });
+}
+
+}  // namespace details
+}  // namespace fast_polynomials
+
+template <typename FieldElementT>
+std::vector<FieldElementT> PolynomialMultiply(
+    gsl::span<const FieldElementT> a, gsl::span<const FieldElementT> b) {
+  using namespace fast_polynomials::details;  // NOLINT
+  if (a.empty() || b.empty()) {
+    return {};
+  }
+  if (std::min(a.size(), b.size()) < kSchoolbookThreshold ||
+      !HasSubGroupOfSize<FieldElementT>(Pow2(Log2Ceil(a.size() + b.size() - 1)))) {
+    return SchoolbookMultiply(a, b);
+  }
+  return FftMultiply(a, b);
+}
+
+template <typename FieldElementT>
+std::vector<FieldElementT> PolynomialInverseModXn(gsl::span<const FieldElementT> f, size_t n) {
+  ASSERT_RELEASE(
+      !f.empty() && f[0] != FieldElementT::Zero(),
+      "The free coefficient of the polynomial must be non-zero.");
+  if (n == 0) {
+    return {};
+  }
+
+  // Newton iteration: if f * g = 1 (mod x^k) then f * g' = 1 (mod x^2k) for g' = g * (2 - f * g).
+  std::vector<FieldElementT> g = {f[0].Inverse()};
+  size_t precision = 1;
+  while (precision < n) {
+    precision = std::min(2 * precision, n);
+    std::vector<FieldElementT> error =
+        PolynomialMultiply<FieldElementT>(f.subspan(0, std::min(f.size(), precision)), g);
+    error.resize(precision, FieldElementT::Zero());
+    for (FieldElementT& coef : error) {
+      coef = -coef;
+    }
+    error[0] += FieldElementT::FromUint(2);
+    g = PolynomialMultiply<FieldElementT>(g, error);
+    g.resize(precision, FieldElementT::Zero());
+  }
+  return g;
+}
+
+template <typename FieldElementT>
+std::pair<std::vector<FieldElementT>, std::vector<FieldElementT>> PolynomialDivRem(
+    gsl::span<const FieldElementT> a, gsl::span<const FieldElementT> b) {
+  ASSERT_RELEASE(
+      !b.empty() && b[b.size() - 1] != FieldElementT::Zero(),
+      "The leading coefficient of the divisor must be non-zero.");
+  if (a.size() < b.size()) {
+    return fast_polynomials::details::DivRemWithReversedInverse<FieldElementT>(a, b, {});
+  }
+  const std::vector<FieldElementT> b_rev(b.rbegin(), b.rend());
+  return fast_polynomials::details::DivRemWithReversedInverse<FieldElementT>(
+      a, b, PolynomialInverseModXn<FieldElementT>(b_rev, a.size() - b.size() + 1));
+}
+
+template <typename FieldElementT>
+void FastMultipointEval(
+    gsl::span<const FieldElementT> points, gsl::span<const FieldElementT> coefs,
+    gsl::span<FieldElementT> outputs) {
+  ASSERT_RELEASE(
+      points.size() == outputs.size(),
+      "The number of outputs must be the same as the number of points.");
+  if (points.empty()) {
+    return;
+  }
+  fast_polynomials::details::MultipointEvalWithTree<FieldElementT>(
+      fast_polynomials::details::BuildSubproductTree(points), points, coefs, outputs);
+}
+
+template <typename FieldElementT>
+std::vector<FieldElementT> FastInterpolation(
+    gsl::span<const FieldElementT> domain, gsl::span<const FieldElementT> values) {
+  using namespace fast_polynomials::details;  // NOLINT
+  ASSERT_RELEASE(domain.size() == values.size(), "Size mismatch.");
+  if (domain.empty()) {
+    return {};
+  }
+  const SubproductTree<FieldElementT> tree = BuildSubproductTree(domain);
+
+  // Let m(x) = prod_i (x - domain[i]). The interpolant is
+  //   p(x) = sum_i values[i] / m'(domain[i]) * m(x) / (x - domain[i]).
+  const std::vector<FieldElementT>& vanishing_poly = tree.back()[0];
+  std::vector<FieldElementT> derivative = FieldElementT::UninitializedVector(domain.size());
+  for (size_t i = 1; i < vanishing_poly.size(); ++i) {
+    derivative[i - 1] = FieldElementT::FromUint(i) * vanishing_poly[i];
+  }
+  std::vector<FieldElementT> derivative_values = FieldElementT::UninitializedVector(domain.size());
+  MultipointEvalWithTree<FieldElementT>(tree, domain, derivative, derivative_values);
+  std::vector<FieldElementT> weights = FieldElementT::UninitializedVector(domain.size());
+  BatchInverse<FieldElementT>(derivative_values, weights);
+  for (size_t i = 0; i < weights.size(); ++i) {
+    weights[i] *= values[i];
+  }
+
+  // Going up the tree, combinations[i] is the interpolant restricted to the points of the i-th node
+  // of the current level, multiplied by the vanishing polynomials of all the other points.
+  // For a leaf with vanishing polynomial l(x), it is sum_i weights[i] * l(x) / (x - domain[i]).
+  std::vector<std::vector<FieldElementT>> combinations(tree[0].size());
+  TaskManager::GetInstance().ParallelFor(tree[0].size(), [&](const TaskInfo& task_info) {
+    const size_t leaf_idx = task_info.start_idx;
+    const std::vector<FieldElementT>& leaf = tree[0][leaf_idx];
+    const size_t leaf_size = leaf.size() - 1;
+    std::vector<FieldElementT>& combination = combinations[leaf_idx];
+    combination.assign(leaf_size, FieldElementT::Zero());
+    for (size_t i = 0; i < leaf_size; ++i) {
+      const size_t point_idx = leaf_idx * kLeafSize + i;
+      // Synthetic division of l(x) by (x - domain[point_idx]).
+      FieldElementT quotient_coef = leaf[leaf_size];
+      for (size_t k = leaf_size; k-- > 0;) {
+        combination[k] += weights[point_idx] * quotient_coef;
+        quotient_coef = leaf[k] + domain[point_idx] * quotient_coef;
+      }
+    }
+  });
+
+  for (size_t level = 0; level + 1 < tree.size(); ++level) {
+    const auto& nodes = tree[level];
+    std::vector<std::vector<FieldElementT>> next_combinations(DivCeil(nodes.size(), 2));
+    TaskManager::GetInstance().ParallelFor(
+        next_combinations.size(), [&](const TaskInfo& task_info) {
+          const size_t idx = task_info.start_idx;
+          if (2 * idx + 1 == nodes.size()) {
+            next_combinations[idx] = std::move(combinations[2 * idx]);
+            return;
+          }
+          std::vector<FieldElementT> left =
+              PolynomialMultiply<FieldElementT>(combinations[2 * idx], nodes[2 * idx + 1]);
+          const std::vector<FieldElementT> right =
+              PolynomialMultiply<FieldElementT>(combinations[2 * idx + 1], nodes[2 * idx]);
+          for (size_t i = 0; i < left.size(); ++i) {
+            left[i] += right[i];
+          }
+          next_combinations[idx] = std::move(left);
+        });
+    combinations = std::move(next_combinations);
+  }
+  return std::move(combinations[0]);
+}
+
+template <typename FieldElementT>
+bool ShouldUseFastMultipointEval(size_t n_coefs, size_t n_points) {
+  using namespace fast_polynomials::details;  // NOLINT
+  if (n_points < kMinFastEvalPoints || n_coefs < kSchoolbookThreshold) {
+    return false;
+  }
+  // All the multiplications are of polynomials with at most 2 * n_points coefficients (see
+  // PolynomialMod()). Without an FFT of that size, they fall back to the schoolbook method.
+  if (!HasSubGroupOfSize<FieldElementT>(Pow2(Log2Ceil(2 * n_points + 1)))) {
+    return false;
+  }
+  const uint64_t log_n_points = Log2Ceil(n_points);
+  const uint64_t horner_cost = static_cast<uint64_t>(n_coefs) * n_points;
+  const uint64_t fast_cost = kFastEvalReductionFactor * n_coefs * log_n_points +
+                             kFastEvalTreeFactor * n_points * log_n_points * log_n_points;
+  return fast_cost < horner_cost;
+}
+
+template <typename FieldElementT>
+void MultipointEval(
+    gsl::span<const FieldElementT> points, gsl::span<const FieldElementT> coefs,
+    gsl::span<FieldElementT> outputs) {
+  if (ShouldUseFastMultipointEval<FieldElementT>(coefs.size(), points.size())) {
+    FastMultipointEval<FieldElementT>(points, coefs, outputs);
+  } else {
+    OptimizedBatchHornerEval<FieldElementT>(points, coefs, outputs);
+  }
+}
+
+}  // namespace starkware
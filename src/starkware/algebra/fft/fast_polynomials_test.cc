@@ -0,0 +1,175 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include "starkware/algebra/fft/fast_polynomials.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "starkware/algebra/field_operations.h"
+#include "starkware/algebra/fields/goldilocks_field_element.h"
+#include "starkware/algebra/fields/long_field_element.h"
+#include "starkware/algebra/fields/prime_field_element.h"
+#include "starkware/algebra/fields/test_field_element.h"
+#include "starkware/algebra/polynomials.h"
+#include "starkware/error_handling/test_utils.h"
+
+namespace starkware {
+namespace {
+
+using testing::HasSubstr;
+
+template <typename T>
+class FastPolynomialsTest : public ::testing::Test {
+ public:
+  Prng prng;
+};
+
+using FieldTypes = ::testing::Types<
+    PrimeFieldElement<252, 0>, LongFieldElement, GoldilocksFieldElement, TestFieldElement>;
+TYPED_TEST_CASE(FastPolynomialsTest, FieldTypes);
+
+template <typename FieldElementT>
+std::vector<FieldElementT> NaiveMultiply(
+    const std::vector<FieldElementT>& a, const std::vector<FieldElementT>& b) {
+  std::vector<FieldElementT> res(a.size() + b.size() - 1, FieldElementT::Zero());
+  for (size_t i = 0; i < a.size(); ++i) {
+    for (size_t j = 0; j < b.size(); ++j) {
+      res[i + j] += a[i] * b[j];
+    }
+  }
+  return res;
+}
+
+TYPED_TEST(FastPolynomialsTest, Multiply) {
+  using FieldElementT = TypeParam;
+  for (const auto& [a_size, b_size] : std::vector<std::pair<size_t, size_t>>{
+           {1, 1}, {5, 3}, {32, 32}, {100, 57}, {257, 300}}) {
+    const auto a = this->prng.template RandomFieldElementVector<FieldElementT>(a_size);
+    const auto b = this->prng.template RandomFieldElementVector<FieldElementT>(b_size);
+    EXPECT_EQ(PolynomialMultiply<FieldElementT>(a, b), NaiveMultiply(a, b));
+  }
+  EXPECT_TRUE(
+      PolynomialMultiply<FieldElementT>({}, std::vector<FieldElementT>{FieldElementT::One()})
+          .empty());
+}
+
+TYPED_TEST(FastPolynomialsTest, InverseModXn) {
+  using FieldElementT = TypeParam;
+  const size_t n = this->prng.UniformInt(1, 200);
+  auto f = this->prng.template RandomFieldElementVector<FieldElementT>(n / 2 + 1);
+  f[0] = RandomNonZeroElement<FieldElementT>(&this->prng);
+  const std::vector<FieldElementT> g = PolynomialInverseModXn<FieldElementT>(f, n);
+  ASSERT_EQ(g.size(), n);
+  std::vector<FieldElementT> product = NaiveMultiply(f, g);
+  EXPECT_EQ(product[0], FieldElementT::One());
+  for (size_t i = 1; i < n; ++i) {
+    EXPECT_EQ(product[i], FieldElementT::Zero());
+  }
+
+  f[0] = FieldElementT::Zero();
+  EXPECT_ASSERT(
+      PolynomialInverseModXn<FieldElementT>(f, n),
+      HasSubstr("The free coefficient of the polynomial must be non-zero."));
+}
+
+TYPED_TEST(FastPolynomialsTest, DivRem) {
+  using FieldElementT = TypeParam;
+  for (const auto& [a_size, b_size] : std::vector<std::pair<size_t, size_t>>{
+           {1, 1}, {10, 3}, {3, 10}, {200, 70}, {300, 1}, {150, 150}}) {
+    const auto a = this->prng.template RandomFieldElementVector<FieldElementT>(a_size);
+    auto b = this->prng.template RandomFieldElementVector<FieldElementT>(b_size - 1);
+    b.push_back(RandomNonZeroElement<FieldElementT>(&this->prng));
+    const auto [quotient, remainder] = PolynomialDivRem<FieldElementT>(a, b);
+    ASSERT_EQ(remainder.size(), b_size - 1);
+    ASSERT_EQ(quotient.size(), a_size >= b_size ? a_size - b_size + 1 : 0);
+
+    // Check that a = b * q + r.
+    std::vector<FieldElementT> reconstructed(std::max(a_size, b_size), FieldElementT::Zero());
+    if (!quotient.empty()) {
+      const auto b_times_q = NaiveMultiply(b, quotient);
+      std::copy(b_times_q.begin(), b_times_q.end(), reconstructed.begin());
+    }
+    for (size_t i = 0; i < remainder.size(); ++i) {
+      reconstructed[i] += remainder[i];
+    }
+    reconstructed.resize(a_size, FieldElementT::Zero());
+    EXPECT_EQ(reconstructed, a);
+  }
+
+  const std::vector<FieldElementT> zero_leading = {FieldElementT::One(), FieldElementT::Zero()};
+  EXPECT_ASSERT(
+      PolynomialDivRem<FieldElementT>(zero_leading, zero_leading),
+      HasSubstr("The leading coefficient of the divisor must be non-zero."));
+}
+
+TYPED_TEST(FastPolynomialsTest, FastMultipointEval) {
+  using FieldElementT = TypeParam;
+  for (const auto& [n_coefs, n_points] : std::vector<std::pair<size_t, size_t>>{
+           {1, 1}, {10, 100}, {100, 10}, {1000, 333}, {3000, 70}, {256, 1024}, {0, 5}}) {
+    const auto coefs = this->prng.template RandomFieldElementVector<FieldElementT>(n_coefs);
+    const auto points = this->prng.template RandomFieldElementVector<FieldElementT>(n_points);
+    std::vector<FieldElementT> outputs = FieldElementT::UninitializedVector(n_points);
+    FastMultipointEval<FieldElementT>(points, coefs, outputs);
+    for (size_t i = 0; i < n_points; ++i) {
+      ASSERT_EQ(outputs[i], HornerEval(points[i], coefs));
+    }
+  }
+}
+
+TYPED_TEST(FastPolynomialsTest, FastInterpolation) {
+  using FieldElementT = TypeParam;
+  for (const size_t size : {1, 2, 31, 33, 300}) {
+    const auto domain = this->prng.template RandomFieldElementVector<FieldElementT>(size);
+    const auto values = this->prng.template RandomFieldElementVector<FieldElementT>(size);
+    const std::vector<FieldElementT> coefs = FastInterpolation<FieldElementT>(domain, values);
+    ASSERT_EQ(coefs.size(), size);
+    for (size_t i = 0; i < size; ++i) {
+      ASSERT_EQ(HornerEval(domain[i], coefs), values[i]);
+    }
+    if (size < 40) {
+      EXPECT_EQ(coefs, LagrangeInterpolation<FieldElementT>(domain, values));
+    }
+  }
+}
+
+TYPED_TEST(FastPolynomialsTest, MultipointEval) {
+  using FieldElementT = TypeParam;
+  // Both small inputs (which use Horner evaluation) and large inputs (which may use the fast
+  // algorithm) should give the same results as HornerEval.
+  for (const auto& [n_coefs, n_points] :
+       std::vector<std::pair<size_t, size_t>>{{16, 4}, {Pow2(12), 2000}}) {
+    const auto coefs = this->prng.template RandomFieldElementVector<FieldElementT>(n_coefs);
+    const auto points = this->prng.template RandomFieldElementVector<FieldElementT>(n_points);
+    std::vector<FieldElementT> outputs = FieldElementT::UninitializedVector(n_points);
+    MultipointEval<FieldElementT>(points, coefs, outputs);
+    for (size_t i = 0; i < n_points; ++i) {
+      ASSERT_EQ(outputs[i], HornerEval(points[i], coefs));
+    }
+  }
+}
+
+TEST(ShouldUseFastMultipointEval, Crossover) {
+  using FieldElementT = PrimeFieldElement<252, 0>;
+  EXPECT_FALSE(ShouldUseFastMultipointEval<FieldElementT>(Pow2(20), 1));
+  EXPECT_FALSE(ShouldUseFastMultipointEval<FieldElementT>(Pow2(20), 32));
+  EXPECT_FALSE(ShouldUseFastMultipointEval<FieldElementT>(16, Pow2(10)));
+  EXPECT_FALSE(ShouldUseFastMultipointEval<FieldElementT>(Pow2(10), Pow2(10)));
+  EXPECT_TRUE(ShouldUseFastMultipointEval<FieldElementT>(Pow2(16), Pow2(12)));
+  // The multiplicative group of TestFieldElement has no subgroup of size 2^31.
+  EXPECT_FALSE(ShouldUseFastMultipointEval<TestFieldElement>(Pow2(31), Pow2(29)));
+}
+
+}  // namespace
+}  // namespace starkware
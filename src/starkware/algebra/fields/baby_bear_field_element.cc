@@ -0,0 +1,69 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include "starkware/algebra/fields/baby_bear_field_element.h"
+
+#include <cstddef>
+
+#include "starkware/utils/serialization.h"
+#include "starkware/utils/to_from_string.h"
+
+namespace starkware {
+
+void BabyBearFieldElement::ToBytes(gsl::span<std::byte> span_out, bool use_big_endian) const {
+  ASSERT_RELEASE(
+      span_out.size() == SizeInBytes(), "Destination span size mismatches field element size.");
+  Serialize(value_, span_out, use_big_endian);
+}
+
+BabyBearFieldElement BabyBearFieldElement::FromBytes(
+    gsl::span<const std::byte> bytes, bool use_big_endian) {
+  ASSERT_RELEASE(
+      bytes.size() == SizeInBytes(), "Source span size mismatches field element size, expected " +
+                                         std::to_string(SizeInBytes()) + ", got " +
+                                         std::to_string(bytes.size()));
+  const auto element = Deserialize<uint32_t>(bytes, use_big_endian);
+  ASSERT_RELEASE(element < kModulus, "The input must be smaller than the field prime.");
+  return BabyBearFieldElement(element);
+}
+
+BabyBearFieldElement BabyBearFieldElement::FromString(const std::string& s) {
+  std::array<std::byte, SizeInBytes()> as_bytes{};
+  HexStringToBytes(s, as_bytes);
+  return FromUint(Deserialize<uint32_t>(as_bytes, /*use_big_endian=*/true));
+}
+
+std::string BabyBearFieldElement::ToString() const {
+  std::array<std::byte, SizeInBytes()> as_bytes{};
+  Serialize(static_cast<uint32_t>(ToStandardForm()[0]), as_bytes, /*use_big_endian=*/true);
+  return BytesToHexString(as_bytes);
+}
+
+BabyBearFieldElement BabyBearFieldElement::RandomElement(PrngBase* prng) {
+  // Note that we don't need to call FromUint here because skiping the call to
+  // FromUint is the same as multiplying by kMontgomeryR^-1 which preserves the distribution.
+  constexpr uint32_t kReleventBits = (1U << (kModulusBits + 1)) - 1;
+
+  std::array<std::byte, SizeInBytes()> bytes{};
+  uint32_t deserialization;
+
+  do {
+    prng->GetRandomBytes(bytes);
+    deserialization = Deserialize<uint32_t>(bytes) & kReleventBits;
+  } while (deserialization >= kModulus);
+
+  return BabyBearFieldElement(deserialization);
+}
+
+}  // namespace starkware
@@ -0,0 +1,160 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#ifndef STARKWARE_ALGEBRA_FIELDS_BABY_BEAR_FIELD_ELEMENT_H_
+#define STARKWARE_ALGEBRA_FIELDS_BABY_BEAR_FIELD_ELEMENT_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "starkware/algebra/big_int.h"
+#include "starkware/algebra/field_element_base.h"
+#include "starkware/error_handling/error_handling.h"
+#include "starkware/randomness/prng.h"
+
+namespace starkware {
+
+/*
+  An element of the BabyBear field, F_p for p = 15 * 2^27 + 1. The multiplicative group has a
+  subgroup of size 2^27, which is large enough for the FFT domains we use.
+
+  Elements are stored in Montgomery representation (with R = 2^32) in a single uint32_t, in the
+  canonical range [0, kModulus).
+  All the arithmetic operations are branch-free: conditional subtractions are written as
+  std::min(x, x - kModulus) over unsigned integers. This allows the compiler to vectorize loops
+  over spans of BabyBearFieldElement (using packed unsigned min instructions) without any special
+  SIMD code.
+*/
+class BabyBearFieldElement : public FieldElementBase<BabyBearFieldElement> {
+ public:
+  static constexpr uint32_t kModulus = 0x78000001;  // 15 * 2**27 + 1.
+  static constexpr uint64_t kModulusBits = Log2Floor(kModulus);
+  static constexpr uint32_t kMontgomeryR = 0xffffffe;  // = 2^32 % kModulus.
+  static constexpr uint32_t kMontgomeryRSquared = 0x45dddde3;
+  static constexpr uint32_t kMontgomeryRCubed = 0x12f37bfb;
+  static constexpr uint32_t kMontgomeryMPrime = 0x77ffffff;  // = (-(kModulus^-1)) mod 2^32.
+
+#ifdef NDEBUG
+  // We allow the use of the default constructor only in Release builds in order to reduce
+  // memory allocation time for vectors of field elements.
+  BabyBearFieldElement() = default;
+#else
+  // In debug builds, we make sure that the default constructor is not called at all.
+  BabyBearFieldElement() = delete;
+#endif
+
+  static constexpr BabyBearFieldElement Zero() { return BabyBearFieldElement(0); }
+
+  static constexpr BabyBearFieldElement One() { return BabyBearFieldElement(kMontgomeryR); }
+
+  static BabyBearFieldElement Uninitialized() { return Zero(); }
+
+  static constexpr BabyBearFieldElement FromUint(uint64_t val) {
+    // Note that because MontgomeryMul divides by r so we need to multiply by r^2 here.
+    return BabyBearFieldElement(
+        MontgomeryMul(static_cast<uint32_t>(val % kModulus), kMontgomeryRSquared));
+  }
+
+  static constexpr BabyBearFieldElement FromBigInt(const BigInt<1>& val) {
+    return FromUint(val[0]);
+  }
+
+  static constexpr BabyBearFieldElement ConstexprFromBigInt(const BigInt<1>& val) {
+    // A wrapper function for consistency with PrimeFieldElement::ConstexprFromBigInt.
+    return FromBigInt(val);
+  }
+
+  constexpr BabyBearFieldElement operator+(const BabyBearFieldElement& rhs) const {
+    // Since kModulus < 2^31 the sum does not overflow.
+    return BabyBearFieldElement(ReduceIfNeeded(value_ + rhs.value_));
+  }
+
+  constexpr BabyBearFieldElement operator-(const BabyBearFieldElement& rhs) const {
+    const uint32_t diff = value_ - rhs.value_;
+    // If diff underflowed, diff + kModulus is the (smaller) correct result.
+    return BabyBearFieldElement(std::min(diff, diff + kModulus));
+  }
+
+  constexpr BabyBearFieldElement operator-() const { return Zero() - *this; }
+
+  constexpr BabyBearFieldElement operator*(const BabyBearFieldElement& rhs) const {
+    return BabyBearFieldElement(MontgomeryMul(value_, rhs.value_));
+  }
+
+  constexpr bool operator==(const BabyBearFieldElement& rhs) const { return value_ == rhs.value_; }
+
+  constexpr BabyBearFieldElement Inverse() const {
+    ASSERT_RELEASE(*this != BabyBearFieldElement::Zero(), "Zero does not have an inverse");
+    // The inverse of value_ = x * R is x^-1 * R^-1. Multiplying it by R^3 in Montgomery form gives
+    // x^-1 * R.
+    return BabyBearFieldElement(MontgomeryMul(
+        static_cast<uint32_t>(BigInt<1>::Inverse(BigInt<1>(value_), BigInt<1>(kModulus))[0]),
+        kMontgomeryRCubed));
+  }
+
+  // Returns a byte serialization of the field element.
+  void ToBytes(gsl::span<std::byte> span_out, bool use_big_endian = true) const;
+
+  static BabyBearFieldElement RandomElement(PrngBase* prng);
+
+  static BabyBearFieldElement FromBytes(
+      gsl::span<const std::byte> bytes, bool use_big_endian = true);
+
+  static BabyBearFieldElement FromString(const std::string& s);
+
+  std::string ToString() const;
+
+  constexpr BigInt<1> ToStandardForm() const { return BigInt<1>(MontgomeryMul(value_, 1)); }
+
+  static constexpr BigInt<1> FieldSize() { return BigInt<1>(kModulus); }
+  static constexpr BabyBearFieldElement Generator() { return BabyBearFieldElement::FromUint(31); }
+  static constexpr std::array<BigInt<1>, 3> PrimeFactors() {
+    return {BigInt<1>(2), BigInt<1>(3), BigInt<1>(5)};
+  }
+  static constexpr size_t SizeInBytes() { return sizeof(uint32_t); }
+  static constexpr uint64_t Characteristic() { return kModulus; }
+
+  static constexpr BabyBearFieldElement FromMontgomeryForm(uint32_t val) {
+    return BabyBearFieldElement(val);
+  }
+
+ private:
+  explicit constexpr BabyBearFieldElement(uint32_t val) : value_(val) {}
+
+  /*
+    Given val in the range [0, 2 * kModulus), returns val mod kModulus.
+  */
+  static constexpr uint32_t ReduceIfNeeded(uint32_t val) { return std::min(val, val - kModulus); }
+
+  /*
+    Computes (x*y / (2^32)) mod kModulus, for x, y in the range [0, kModulus).
+  */
+  static constexpr uint32_t MontgomeryMul(uint32_t x, uint32_t y) {
+    const uint64_t mul_res = static_cast<uint64_t>(x) * y;
+    const uint32_t u = static_cast<uint32_t>(mul_res) * kMontgomeryMPrime;
+    // mul_res + u * kModulus < 2^62 + 2^63, so no overflow occurs, and the result is divisible by
+    // 2^32. The quotient is in the range [0, 2 * kModulus).
+    const uint64_t res = mul_res + static_cast<uint64_t>(u) * kModulus;
+    return ReduceIfNeeded(static_cast<uint32_t>(res >> 32));
+  }
+
+  uint32_t value_ = 0;
+};
+
+}  // namespace starkware
+
+#endif  // STARKWARE_ALGEBRA_FIELDS_BABY_BEAR_FIELD_ELEMENT_H_
@@ -0,0 +1,115 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include "starkware/algebra/fields/baby_bear_field_element.h"
+
+#include "gtest/gtest.h"
+
+#include "starkware/algebra/field_operations.h"
+#include "starkware/error_handling/test_utils.h"
+#include "starkware/utils/serialization.h"
+
+namespace starkware {
+namespace {
+
+using testing::HasSubstr;
+
+using FieldElementT = BabyBearFieldElement;
+constexpr uint64_t kModulus = FieldElementT::kModulus;
+
+uint64_t ToUint(const FieldElementT& x) { return x.ToStandardForm()[0]; }
+
+TEST(BabyBearFieldElement, ToStandardForm) {
+  ASSERT_EQ(FieldElementT::FromUint(0).ToStandardForm(), BigInt<1>(0));
+  ASSERT_EQ(FieldElementT::One().ToStandardForm(), BigInt<1>(1));
+  ASSERT_EQ(
+      (FieldElementT::FromUint(10) + FieldElementT::FromUint(103)).ToStandardForm(),
+      BigInt<1>(113));
+  ASSERT_EQ(FieldElementT::FromUint(kModulus + 5).ToStandardForm(), BigInt<1>(5));
+}
+
+TEST(BabyBearFieldElement, Constexpr) {
+  constexpr FieldElementT kV = FieldElementT::FromUint(15);
+  constexpr FieldElementT kVInv = kV.Inverse();
+  EXPECT_EQ(kV * kVInv, FieldElementT::One());
+}
+
+TEST(BabyBearFieldElement, kModulusBits) {
+  static_assert(FieldElementT::kModulusBits == 30, "Wrong number of bits");
+  static_assert(FieldElementT::kModulus < Pow2(31), "Modulus should fit in 31 bits");
+}
+
+TEST(BabyBearFieldElement, ArithmeticMatchesUint64) {
+  Prng prng;
+  for (size_t i = 0; i < 1000; ++i) {
+    const auto a = FieldElementT::RandomElement(&prng);
+    const auto b = FieldElementT::RandomElement(&prng);
+    const uint64_t a_val = ToUint(a);
+    const uint64_t b_val = ToUint(b);
+    EXPECT_EQ(ToUint(a + b), (a_val + b_val) % kModulus);
+    EXPECT_EQ(ToUint(a - b), (a_val + kModulus - b_val) % kModulus);
+    EXPECT_EQ(ToUint(a * b), (a_val * b_val) % kModulus);
+  }
+}
+
+TEST(BabyBearFieldElement, EdgeCases) {
+  const auto minus_one = FieldElementT::FromUint(kModulus - 1);
+  EXPECT_EQ(minus_one, -FieldElementT::One());
+  EXPECT_EQ(minus_one + minus_one, -FieldElementT::FromUint(2));
+  EXPECT_EQ(minus_one * minus_one, FieldElementT::One());
+  EXPECT_EQ(FieldElementT::Zero() - minus_one, FieldElementT::One());
+  EXPECT_EQ(-FieldElementT::Zero(), FieldElementT::Zero());
+}
+
+TEST(BabyBearFieldElement, Inverse) {
+  Prng prng;
+  const auto a = RandomNonZeroElement<FieldElementT>(&prng);
+  EXPECT_EQ(a * a.Inverse(), FieldElementT::One());
+  EXPECT_ASSERT(FieldElementT::Zero().Inverse(), HasSubstr("Zero does not have an inverse"));
+}
+
+TEST(BabyBearFieldElement, Generator) {
+  const uint64_t group_size = kModulus - 1;
+  EXPECT_EQ(Pow(FieldElementT::Generator(), group_size), FieldElementT::One());
+  for (const auto& factor : FieldElementT::PrimeFactors()) {
+    ASSERT_EQ(group_size % factor[0], 0U);
+    EXPECT_NE(Pow(FieldElementT::Generator(), group_size / factor[0]), FieldElementT::One());
+  }
+  // The FFT domains require a subgroup of size 2^27.
+  EXPECT_EQ(group_size % Pow2(27), 0U);
+}
+
+TEST(BabyBearFieldElement, FromBytes) {
+  std::array<std::byte, FieldElementT::SizeInBytes()> modulus_as_bytes{};
+  Serialize<uint32_t>(FieldElementT::kModulus, modulus_as_bytes, /*use_big_endian=*/true);
+  EXPECT_ASSERT(
+      FieldElementT::FromBytes(modulus_as_bytes),
+      HasSubstr("The input must be smaller than the field prime."));
+
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  std::array<std::byte, FieldElementT::SizeInBytes()> to_bytes_buffer{};
+  a.ToBytes(to_bytes_buffer);
+  EXPECT_EQ(FieldElementT::FromBytes(to_bytes_buffer), a);
+}
+
+TEST(BabyBearFieldElement, ToFromString) {
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  EXPECT_EQ(FieldElementT::FromString(a.ToString()), a);
+  EXPECT_EQ(FieldElementT::FromString("0x71"), FieldElementT::FromUint(113));
+}
+
+}  // namespace
+}  // namespace starkware
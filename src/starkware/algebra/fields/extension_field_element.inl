@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions
 // and limitations under the License.
 
+#include "starkware/algebra/fields/goldilocks_field_element.h"
 #include "starkware/algebra/fields/prime_field_element.h"
 #include "starkware/algebra/fields/test_field_element.h"
 
@@ -125,6 +126,11 @@ inline auto ExtensionFieldElement<LongFieldElement>::Generator() -> ExtensionFie
   return ExtensionFieldElement(LongFieldElement::FromUint(3), LongFieldElement::FromUint(1));
 }
 
+template <>
+inline auto ExtensionFieldElement<GoldilocksFieldElement>::Generator() -> ExtensionFieldElement {
+  return ExtensionFieldElement(GoldilocksFieldElement::FromUint(11), GoldilocksFieldElement::One());
+}
+
 template <typename FieldElementT>
 inline auto ExtensionFieldElement<FieldElementT>::Generator() -> ExtensionFieldElement {
   ASSERT_RELEASE(false, "ExtensionFieldElement is unsupported over this field.");
@@ -156,4 +162,10 @@ constexpr auto ExtensionFieldElement<LongFieldElement>::PrimeFactors() {
                                    0xd3_Z, 0x125_Z, 0x1c9_Z, 0x52be0f_Z, 0x1520bdb_Z};
 }
 
+template <>
+constexpr auto ExtensionFieldElement<GoldilocksFieldElement>::PrimeFactors() {
+  return std::array<BigInt<1>, 9>{0x2_Z,   0x3_Z,   0x5_Z,     0x7_Z,           0x11_Z,
+                                  0xb3_Z, 0x101_Z, 0x10001_Z, 0x1a26d19f0e18ed_Z};
+}
+
 }  // namespace starkware
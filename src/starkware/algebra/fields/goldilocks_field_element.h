@@ -0,0 +1,159 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#ifndef STARKWARE_ALGEBRA_FIELDS_GOLDILOCKS_FIELD_ELEMENT_H_
+#define STARKWARE_ALGEBRA_FIELDS_GOLDILOCKS_FIELD_ELEMENT_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "starkware/algebra/big_int.h"
+#include "starkware/algebra/field_element_base.h"
+#include "starkware/algebra/uint128.h"
+#include "starkware/error_handling/error_handling.h"
+#include "starkware/randomness/prng.h"
+
+namespace starkware {
+
+/*
+  An element of the Goldilocks field, F_p for p = 2^64 - 2^32 + 1.
+
+  Unlike LongFieldElement, elements are not stored in Montgomery representation. The special form
+  of the modulus allows reducing a 128-bit product using only additions and subtractions, since
+  2^64 = 2^32 - 1 (mod p) and 2^96 = -1 (mod p).
+  The stored value is always in the canonical range [0, kModulus).
+*/
+class GoldilocksFieldElement : public FieldElementBase<GoldilocksFieldElement> {
+ public:
+  static constexpr uint64_t kModulus = 0xffffffff00000001;  // 2**64 - 2**32 + 1.
+  static constexpr uint64_t kModulusBits = Log2Floor(kModulus);
+  // kEpsilon = 2^64 % kModulus = 2^32 - 1.
+  static constexpr uint64_t kEpsilon = 0xffffffff;
+
+#ifdef NDEBUG
+  // We allow the use of the default constructor only in Release builds in order to reduce
+  // memory allocation time for vectors of field elements.
+  GoldilocksFieldElement() = default;
+#else
+  // In debug builds, we make sure that the default constructor is not called at all.
+  GoldilocksFieldElement() = delete;
+#endif
+
+  static constexpr GoldilocksFieldElement Zero() { return GoldilocksFieldElement(0); }
+
+  static constexpr GoldilocksFieldElement One() { return GoldilocksFieldElement(1); }
+
+  static GoldilocksFieldElement Uninitialized() { return Zero(); }
+
+  static constexpr GoldilocksFieldElement FromUint(uint64_t val) {
+    return GoldilocksFieldElement(ReduceIfNeeded(val));
+  }
+
+  static constexpr GoldilocksFieldElement FromBigInt(const BigInt<1>& val) {
+    return FromUint(val[0]);
+  }
+
+  static constexpr GoldilocksFieldElement ConstexprFromBigInt(const BigInt<1>& val) {
+    // A wrapper function for consistency with PrimeFieldElement::ConstexprFromBigInt.
+    return FromBigInt(val);
+  }
+
+  constexpr GoldilocksFieldElement operator+(const GoldilocksFieldElement& rhs) const {
+    // Both operands are smaller than kModulus, so after adding kEpsilon on overflow the sum can
+    // not overflow again.
+    uint64_t sum = value_ + rhs.value_;
+    sum += (sum < value_) ? kEpsilon : 0;
+    return GoldilocksFieldElement(ReduceIfNeeded(sum));
+  }
+
+  constexpr GoldilocksFieldElement operator-(const GoldilocksFieldElement& rhs) const {
+    // On underflow the wrapped difference is off by 2^64 = kModulus + kEpsilon.
+    const uint64_t diff = value_ - rhs.value_;
+    return GoldilocksFieldElement(diff - ((rhs.value_ > value_) ? kEpsilon : 0));
+  }
+
+  constexpr GoldilocksFieldElement operator-() const { return Zero() - *this; }
+
+  constexpr GoldilocksFieldElement operator*(const GoldilocksFieldElement& rhs) const {
+    return GoldilocksFieldElement(Reduce128(Umul128(value_, rhs.value_)));
+  }
+
+  constexpr bool operator==(const GoldilocksFieldElement& rhs) const {
+    return value_ == rhs.value_;
+  }
+
+  constexpr GoldilocksFieldElement Inverse() const {
+    ASSERT_RELEASE(*this != GoldilocksFieldElement::Zero(), "Zero does not have an inverse");
+    return GoldilocksFieldElement(
+        BigInt<1>::Inverse(BigInt<1>(value_), BigInt<1>(kModulus))[0]);
+  }
+
+  // Returns a byte serialization of the field element.
+  void ToBytes(gsl::span<std::byte> span_out, bool use_big_endian = true) const;
+
+  static GoldilocksFieldElement RandomElement(PrngBase* prng);
+
+  static GoldilocksFieldElement FromBytes(
+      gsl::span<const std::byte> bytes, bool use_big_endian = true);
+
+  static GoldilocksFieldElement FromString(const std::string& s);
+
+  std::string ToString() const;
+
+  constexpr BigInt<1> ToStandardForm() const { return BigInt<1>(value_); }
+
+  static constexpr BigInt<1> FieldSize() { return BigInt<1>(kModulus); }
+  static constexpr GoldilocksFieldElement Generator() { return GoldilocksFieldElement(7); }
+  static constexpr std::array<BigInt<1>, 6> PrimeFactors() {
+    return {BigInt<1>(2),   BigInt<1>(3),   BigInt<1>(5),
+            BigInt<1>(17), BigInt<1>(257), BigInt<1>(65537)};
+  }
+  static constexpr size_t SizeInBytes() { return sizeof(uint64_t); }
+  static constexpr uint64_t Characteristic() { return kModulus; }
+
+ private:
+  explicit constexpr GoldilocksFieldElement(uint64_t val) : value_(val) {}
+
+  static constexpr uint64_t ReduceIfNeeded(uint64_t val) {
+    return val >= kModulus ? val - kModulus : val;
+  }
+
+  /*
+    Reduces a 128-bit value modulo kModulus.
+    Writing val = lo + 2^64 * hi_lo + 2^96 * hi_hi (where lo is 64 bits and hi_lo, hi_hi are 32
+    bits each), we have val = lo - hi_hi + hi_lo * kEpsilon (mod kModulus).
+  */
+  static constexpr uint64_t Reduce128(const Uint128 val) {
+    const auto lo = static_cast<uint64_t>(val);
+    const auto hi = static_cast<uint64_t>(val >> 64);
+    const uint64_t hi_hi = hi >> 32;
+    const uint64_t hi_lo = hi & kEpsilon;
+
+    uint64_t tmp = lo - hi_hi;
+    tmp -= (hi_hi > lo) ? kEpsilon : 0;
+    // hi_lo * kEpsilon < 2^64 - 2^33 + 1, so adding it can overflow at most once.
+    const uint64_t product = hi_lo * kEpsilon;
+    uint64_t res = tmp + product;
+    res += (res < product) ? kEpsilon : 0;
+    return ReduceIfNeeded(res);
+  }
+
+  uint64_t value_ = 0;
+};
+
+}  // namespace starkware
+
+#endif  // STARKWARE_ALGEBRA_FIELDS_GOLDILOCKS_FIELD_ELEMENT_H_
@@ -0,0 +1,137 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include "starkware/algebra/fields/goldilocks_field_element.h"
+
+#include "gtest/gtest.h"
+
+#include "starkware/algebra/field_operations.h"
+#include "starkware/algebra/fields/extension_field_element.h"
+#include "starkware/error_handling/test_utils.h"
+#include "starkware/utils/serialization.h"
+
+namespace starkware {
+namespace {
+
+using testing::HasSubstr;
+
+using FieldElementT = GoldilocksFieldElement;
+constexpr uint64_t kModulus = FieldElementT::kModulus;
+
+uint64_t ToUint(const FieldElementT& x) { return x.ToStandardForm()[0]; }
+
+TEST(GoldilocksFieldElement, ToStandardForm) {
+  ASSERT_EQ(FieldElementT::FromUint(0).ToStandardForm(), BigInt<1>(0));
+  ASSERT_EQ(
+      (FieldElementT::FromUint(10) + FieldElementT::FromUint(103)).ToStandardForm(),
+      BigInt<1>(113));
+  ASSERT_EQ(FieldElementT::FromUint(kModulus + 5).ToStandardForm(), BigInt<1>(5));
+}
+
+TEST(GoldilocksFieldElement, Constexpr) {
+  constexpr FieldElementT kV = FieldElementT::FromUint(15);
+  constexpr FieldElementT kVInv = kV.Inverse();
+  EXPECT_EQ(kV * kVInv, FieldElementT::One());
+}
+
+TEST(GoldilocksFieldElement, ArithmeticMatchesUint128) {
+  Prng prng;
+  for (size_t i = 0; i < 1000; ++i) {
+    const auto a = FieldElementT::RandomElement(&prng);
+    const auto b = FieldElementT::RandomElement(&prng);
+    const Uint128 a_val = ToUint(a);
+    const Uint128 b_val = ToUint(b);
+    EXPECT_EQ(ToUint(a + b), static_cast<uint64_t>((a_val + b_val) % kModulus));
+    EXPECT_EQ(ToUint(a - b), static_cast<uint64_t>((a_val + kModulus - b_val) % kModulus));
+    EXPECT_EQ(ToUint(a * b), static_cast<uint64_t>((a_val * b_val) % kModulus));
+  }
+}
+
+TEST(GoldilocksFieldElement, EdgeCases) {
+  const auto minus_one = FieldElementT::FromUint(kModulus - 1);
+  const auto epsilon = FieldElementT::FromUint(FieldElementT::kEpsilon);
+  EXPECT_EQ(minus_one, -FieldElementT::One());
+  EXPECT_EQ(minus_one + minus_one, -FieldElementT::FromUint(2));
+  EXPECT_EQ(minus_one * minus_one, FieldElementT::One());
+  EXPECT_EQ(FieldElementT::Zero() - minus_one, FieldElementT::One());
+  // 2^64 = kEpsilon (mod kModulus) and 2^96 = -1 (mod kModulus).
+  const auto two_to_32 = FieldElementT::FromUint(uint64_t(1) << 32);
+  EXPECT_EQ(two_to_32 * two_to_32, epsilon);
+  EXPECT_EQ(two_to_32 * two_to_32 * two_to_32, minus_one);
+  EXPECT_EQ(epsilon * epsilon, FieldElementT::FromUint(0xfffffffe00000001 % kModulus));
+}
+
+TEST(GoldilocksFieldElement, Inverse) {
+  Prng prng;
+  const auto a = RandomNonZeroElement<FieldElementT>(&prng);
+  EXPECT_EQ(a * a.Inverse(), FieldElementT::One());
+  EXPECT_ASSERT(FieldElementT::Zero().Inverse(), HasSubstr("Zero does not have an inverse"));
+}
+
+TEST(GoldilocksFieldElement, Generator) {
+  const uint64_t group_size = kModulus - 1;
+  EXPECT_EQ(Pow(FieldElementT::Generator(), group_size), FieldElementT::One());
+  for (const auto& factor : FieldElementT::PrimeFactors()) {
+    ASSERT_EQ(group_size % factor[0], 0U);
+    EXPECT_NE(Pow(FieldElementT::Generator(), group_size / factor[0]), FieldElementT::One());
+  }
+}
+
+TEST(GoldilocksFieldElement, ExtensionFieldGenerator) {
+  using ExtensionFieldElementT = ExtensionFieldElement<FieldElementT>;
+  using IntType = decltype(ExtensionFieldElementT::FieldSize());
+  const IntType group_size =
+      IntType::Sub(ExtensionFieldElementT::FieldSize(), IntType::One()).first;
+  const auto generator = ExtensionFieldElementT::Generator();
+  EXPECT_EQ(Pow(generator, group_size.ToBoolVector()), ExtensionFieldElementT::One());
+  IntType cur = group_size;
+  for (const IntType factor : ExtensionFieldElementT::PrimeFactors()) {
+    const auto [quotient, remainder] = IntType::Div(group_size, factor);
+    ASSERT_EQ(remainder, IntType::Zero());
+    EXPECT_NE(Pow(generator, quotient.ToBoolVector()), ExtensionFieldElementT::One());
+    // Divide cur by factor as many times as possible, to check that the factors are complete.
+    while (IntType::Div(cur, factor).second == IntType::Zero()) {
+      cur = IntType::Div(cur, factor).first;
+    }
+  }
+  EXPECT_EQ(cur, IntType::One());
+}
+
+TEST(GoldilocksFieldElement, FromInt) {
+  EXPECT_EQ(FieldElementT::FromInt(345), FieldElementT::FromUint(345));
+  EXPECT_EQ(FieldElementT::FromInt(-20), FieldElementT::Zero() - FieldElementT::FromUint(20));
+}
+
+TEST(GoldilocksFieldElement, FromBytes) {
+  std::array<std::byte, FieldElementT::SizeInBytes()> modulus_as_bytes{};
+  Serialize<uint64_t>(kModulus, modulus_as_bytes, /*use_big_endian=*/true);
+  EXPECT_ASSERT(
+      FieldElementT::FromBytes(modulus_as_bytes),
+      HasSubstr("The input must be smaller than the field prime."));
+
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  std::array<std::byte, FieldElementT::SizeInBytes()> to_bytes_buffer{};
+  a.ToBytes(to_bytes_buffer);
+  EXPECT_EQ(FieldElementT::FromBytes(to_bytes_buffer), a);
+}
+
+TEST(GoldilocksFieldElement, ToFromString) {
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  EXPECT_EQ(FieldElementT::FromString(a.ToString()), a);
+}
+
+}  // namespace
+}  // namespace starkware
@@ -0,0 +1,176 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#ifndef STARKWARE_ALGEBRA_FIELDS_QUARTIC_EXTENSION_FIELD_ELEMENT_H_
+#define STARKWARE_ALGEBRA_FIELDS_QUARTIC_EXTENSION_FIELD_ELEMENT_H_
+
+#include <array>
+#include <string>
+
+#include "starkware/algebra/big_int.h"
+#include "starkware/algebra/field_element_base.h"
+#include "starkware/algebra/field_operations.h"
+
+namespace starkware {
+
+/*
+  Represents a degree 4 extension field element of a given field F (F's elements are of type
+  FieldElementT). The extension field is F[X]/(X^4-g) for g = FieldElementT::Generator(), and an
+  element is represented by its 4 coefficients coef0 + coef1*X + coef2*X^2 + coef3*X^3.
+
+  X^4-g is irreducible whenever g is not a square and |F| = 1 (mod 4), which holds for the
+  generator of small FFT-friendly fields. This extension is intended for fields that are too small
+  for a degree 2 extension to provide enough security for the random challenges (e.g., 31-bit
+  fields), where ExtensionFieldElement should be used otherwise.
+*/
+template <typename FieldElementT>
+class QuarticExtensionFieldElement
+    : public FieldElementBase<QuarticExtensionFieldElement<FieldElementT>> {
+ public:
+  static constexpr size_t kDegree = 4;
+
+#ifdef NDEBUG
+  // We allow the use of the default constructor only in Release builds in order to reduce
+  // memory allocation time for vectors of field elements.
+  QuarticExtensionFieldElement() = default;
+#else
+  // In debug builds, we make sure that the default constructor is not called at all.
+  QuarticExtensionFieldElement() = delete;
+#endif
+
+  /*
+    Creates an extension field element from its four coefficients.
+  */
+  constexpr QuarticExtensionFieldElement(
+      const FieldElementT& coef0, const FieldElementT& coef1, const FieldElementT& coef2,
+      const FieldElementT& coef3)
+      : coefs_{coef0, coef1, coef2, coef3} {}
+
+  static QuarticExtensionFieldElement Uninitialized() { return Zero(); }
+
+  const auto& GetCoef(size_t index) const { return coefs_.at(index); }
+
+  QuarticExtensionFieldElement operator+(const QuarticExtensionFieldElement& rhs) const;
+
+  QuarticExtensionFieldElement operator-(const QuarticExtensionFieldElement& rhs) const;
+
+  QuarticExtensionFieldElement operator-() const {
+    return QuarticExtensionFieldElement(-coefs_[0], -coefs_[1], -coefs_[2], -coefs_[3]);
+  }
+
+  QuarticExtensionFieldElement operator*(const QuarticExtensionFieldElement& rhs) const;
+
+  bool operator==(const QuarticExtensionFieldElement& rhs) const { return coefs_ == rhs.coefs_; }
+
+  QuarticExtensionFieldElement Inverse() const;
+
+  static constexpr QuarticExtensionFieldElement Zero() {
+    return QuarticExtensionFieldElement(
+        FieldElementT::Zero(), FieldElementT::Zero(), FieldElementT::Zero(),
+        FieldElementT::Zero());
+  }
+
+  static constexpr QuarticExtensionFieldElement One() {
+    return QuarticExtensionFieldElement(
+        FieldElementT::One(), FieldElementT::Zero(), FieldElementT::Zero(), FieldElementT::Zero());
+  }
+
+  /*
+    Returns a random extension field element: all its coefficients are random FieldElementT
+    generated by FieldElementT::RandomElement.
+  */
+  static QuarticExtensionFieldElement RandomElement(PrngBase* prng) {
+    const auto coef0 = FieldElementT::RandomElement(prng);
+    const auto coef1 = FieldElementT::RandomElement(prng);
+    const auto coef2 = FieldElementT::RandomElement(prng);
+    const auto coef3 = FieldElementT::RandomElement(prng);
+    return QuarticExtensionFieldElement(coef0, coef1, coef2, coef3);
+  }
+
+  /*
+    Returns a base field random element as an extension field element.
+  */
+  static QuarticExtensionFieldElement RandomBaseElement(PrngBase* prng) {
+    return FromBaseFieldElement(FieldElementT::RandomElement(prng));
+  }
+
+  static constexpr QuarticExtensionFieldElement FromBaseFieldElement(const FieldElementT& elm) {
+    return QuarticExtensionFieldElement(
+        elm, FieldElementT::Zero(), FieldElementT::Zero(), FieldElementT::Zero());
+  }
+
+  /*
+    Converts this extension field element to bytes using ToBytes of FieldElementT. The result is
+    the concatenation of the serializations of the coefficients, from coef0 to coef3.
+  */
+  void ToBytes(gsl::span<std::byte> span_out, bool use_big_endian = true) const;
+
+  static QuarticExtensionFieldElement FromBytes(
+      gsl::span<const std::byte> bytes, bool use_big_endian = true);
+
+  std::string ToString() const;
+
+  static QuarticExtensionFieldElement FromString(const std::string& s);
+
+  static constexpr auto FieldSize() {
+    const auto field_size_squared = FieldElementT::FieldSize() * FieldElementT::FieldSize();
+    return field_size_squared * field_size_squared;
+  }
+
+  static constexpr QuarticExtensionFieldElement FromUint(uint64_t val) {
+    return FromBaseFieldElement(FieldElementT::FromUint(val));
+  }
+
+  static constexpr QuarticExtensionFieldElement ConstexprFromBigInt(const BigInt<1>& val) {
+    return FromBaseFieldElement(FieldElementT::ConstexprFromBigInt(val));
+  }
+
+  static QuarticExtensionFieldElement Generator();
+
+  static constexpr auto Characteristic() { return FieldElementT::Characteristic(); }
+
+  static constexpr auto PrimeFactors();
+
+  static constexpr size_t SizeInBytes() { return FieldElementT::SizeInBytes() * kDegree; }
+
+  bool InBaseField() const {
+    return coefs_[1] == FieldElementT::Zero() && coefs_[2] == FieldElementT::Zero() &&
+           coefs_[3] == FieldElementT::Zero();
+  }
+
+  static QuarticExtensionFieldElement GetBaseGenerator() {
+    return FromBaseFieldElement(FieldElementT::Generator());
+  }
+
+  /*
+    Returns the image of this element under the Frobenius automorphism x -> x^p, where p is the
+    size of the base field.
+    Since X^p = X * g^((p-1)/4), the automorphism multiplies coef_i by g^(i*(p-1)/4).
+  */
+  QuarticExtensionFieldElement Frobenius() const;
+
+ private:
+  /*
+    The non-residue defining the extension, X^4 = NonResidue().
+  */
+  static FieldElementT NonResidue() { return FieldElementT::Generator(); }
+
+  std::array<FieldElementT, kDegree> coefs_;
+};
+
+}  // namespace starkware
+
+#include "starkware/algebra/fields/quartic_extension_field_element.inl"
+
+#endif  // STARKWARE_ALGEBRA_FIELDS_QUARTIC_EXTENSION_FIELD_ELEMENT_H_
@@ -0,0 +1,150 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include "starkware/algebra/fields/baby_bear_field_element.h"
+#include "starkware/error_handling/error_handling.h"
+
+namespace starkware {
+
+template <typename FieldElementT>
+QuarticExtensionFieldElement<FieldElementT> QuarticExtensionFieldElement<FieldElementT>::operator+(
+    const QuarticExtensionFieldElement<FieldElementT>& rhs) const {
+  return {
+      coefs_[0] + rhs.coefs_[0], coefs_[1] + rhs.coefs_[1], coefs_[2] + rhs.coefs_[2],
+      coefs_[3] + rhs.coefs_[3]};
+}
+
+template <typename FieldElementT>
+QuarticExtensionFieldElement<FieldElementT> QuarticExtensionFieldElement<FieldElementT>::operator-(
+    const QuarticExtensionFieldElement<FieldElementT>& rhs) const {
+  return {
+      coefs_[0] - rhs.coefs_[0], coefs_[1] - rhs.coefs_[1], coefs_[2] - rhs.coefs_[2],
+      coefs_[3] - rhs.coefs_[3]};
+}
+
+template <typename FieldElementT>
+ALWAYS_INLINE QuarticExtensionFieldElement<FieldElementT>
+QuarticExtensionFieldElement<FieldElementT>::operator*(
+    const QuarticExtensionFieldElement<FieldElementT>& rhs) const {
+  const auto& [a0, a1, a2, a3] = coefs_;
+  const auto& [b0, b1, b2, b3] = rhs.coefs_;
+  const FieldElementT w = NonResidue();
+  // Schoolbook multiplication, where the coefficients of X^4, X^5 and X^6 are reduced using
+  // X^4 = w.
+  return {
+      a0 * b0 + w * (a1 * b3 + a2 * b2 + a3 * b1), a0 * b1 + a1 * b0 + w * (a2 * b3 + a3 * b2),
+      a0 * b2 + a1 * b1 + a2 * b0 + w * (a3 * b3), a0 * b3 + a1 * b2 + a2 * b1 + a3 * b0};
+}
+
+template <typename FieldElementT>
+QuarticExtensionFieldElement<FieldElementT> QuarticExtensionFieldElement<FieldElementT>::Inverse()
+    const {
+  ASSERT_RELEASE(*this != Zero(), "Zero does not have an inverse");
+  const auto& [a0, a1, a2, a3] = coefs_;
+  const FieldElementT w = NonResidue();
+  const FieldElementT two = FieldElementT::FromUint(2);
+
+  // Write a(X) = e(X^2) + X * o(X^2). Then b(X^2) = a(X) * a(-X) = e(X^2)^2 - X^2 * o(X^2)^2 is a
+  // polynomial in Y = X^2, where Y^2 = w, i.e., b is an element of the degree 2 sub-extension.
+  const FieldElementT c0 = a0 * a0 + w * (a2 * a2 - two * a1 * a3);
+  const FieldElementT c1 = two * a0 * a2 - a1 * a1 - w * a3 * a3;
+
+  // b(Y) * b(-Y) = c0^2 - w * c1^2 is an element of the base field.
+  const FieldElementT norm_inv = (c0 * c0 - w * c1 * c1).Inverse();
+  const FieldElementT d0 = c0 * norm_inv;
+  const FieldElementT d2 = -c1 * norm_inv;
+
+  // a^-1 = a(-X) * b(X^2)^-1 = (a0 - a1*X + a2*X^2 - a3*X^3) * (d0 + d2*X^2).
+  return {a0 * d0 + w * a2 * d2, -(a1 * d0 + w * a3 * d2), a0 * d2 + a2 * d0, -(a1 * d2 + a3 * d0)};
+}
+
+template <typename FieldElementT>
+QuarticExtensionFieldElement<FieldElementT> QuarticExtensionFieldElement<FieldElementT>::Frobenius()
+    const {
+  // zeta = g^((p-1)/4) is a primitive 4th root of unity in the base field.
+  static const FieldElementT kZeta = GetSubGroupGenerator<FieldElementT>(kDegree);
+  static const FieldElementT kZetaSquared = kZeta * kZeta;
+  static const FieldElementT kZetaCubed = kZetaSquared * kZeta;
+  return {coefs_[0], coefs_[1] * kZeta, coefs_[2] * kZetaSquared, coefs_[3] * kZetaCubed};
+}
+
+template <typename FieldElementT>
+void QuarticExtensionFieldElement<FieldElementT>::ToBytes(
+    gsl::span<std::byte> span_out, bool use_big_endian) const {
+  for (size_t i = 0; i < kDegree; ++i) {
+    coefs_[i].ToBytes(
+        span_out.subspan(i * FieldElementT::SizeInBytes(), FieldElementT::SizeInBytes()),
+        use_big_endian);
+  }
+}
+
+template <typename FieldElementT>
+QuarticExtensionFieldElement<FieldElementT> QuarticExtensionFieldElement<FieldElementT>::FromBytes(
+    gsl::span<const std::byte> bytes, bool use_big_endian) {
+  const auto coef = [&](size_t i) {
+    return FieldElementT::FromBytes(
+        bytes.subspan(i * FieldElementT::SizeInBytes(), FieldElementT::SizeInBytes()),
+        use_big_endian);
+  };
+  return QuarticExtensionFieldElement(coef(0), coef(1), coef(2), coef(3));
+}
+
+template <typename FieldElementT>
+std::string QuarticExtensionFieldElement<FieldElementT>::ToString() const {
+  return coefs_[0].ToString() + "::" + coefs_[1].ToString() + "::" + coefs_[2].ToString() +
+         "::" + coefs_[3].ToString();
+}
+
+template <typename FieldElementT>
+QuarticExtensionFieldElement<FieldElementT>
+QuarticExtensionFieldElement<FieldElementT>::FromString(const std::string& s) {
+  // When converting a base field element string to an extension field, the higher coefficients
+  // might not be mentioned in the string. Missing coefficients are treated as zero.
+  QuarticExtensionFieldElement res = Zero();
+  size_t start = 0;
+  for (size_t i = 0; i < kDegree && start <= s.length(); ++i) {
+    const size_t split_point = s.find("::", start);
+    const size_t end = split_point == std::string::npos ? s.length() : split_point;
+    res.coefs_[i] = FieldElementT::FromString(s.substr(start, end - start));
+    if (split_point == std::string::npos) {
+      break;
+    }
+    start = split_point + 2;
+  }
+  return res;
+}
+
+// The following Generator() and PrimeFactors() functions are field specific definitions.
+
+template <>
+inline auto QuarticExtensionFieldElement<BabyBearFieldElement>::Generator()
+    -> QuarticExtensionFieldElement {
+  return QuarticExtensionFieldElement(
+      BabyBearFieldElement::FromUint(5), BabyBearFieldElement::One(), BabyBearFieldElement::Zero(),
+      BabyBearFieldElement::Zero());
+}
+
+template <typename FieldElementT>
+inline auto QuarticExtensionFieldElement<FieldElementT>::Generator()
+    -> QuarticExtensionFieldElement {
+  ASSERT_RELEASE(false, "QuarticExtensionFieldElement is unsupported over this field.");
+}
+
+template <>
+constexpr auto QuarticExtensionFieldElement<BabyBearFieldElement>::PrimeFactors() {
+  return std::array<BigInt<1>, 8>{0x2_Z,  0x3_Z,    0x5_Z,       0x1f_Z,
+                                  0x61_Z, 0x2fd1_Z, 0x1ef7bdf_Z, 0x18d65727ad1_Z};
+}
+
+}  // namespace starkware
@@ -0,0 +1,125 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include "starkware/algebra/fields/quartic_extension_field_element.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "starkware/algebra/fields/baby_bear_field_element.h"
+#include "starkware/error_handling/test_utils.h"
+
+namespace starkware {
+namespace {
+
+using BaseFieldElementT = BabyBearFieldElement;
+using FieldElementT = QuarticExtensionFieldElement<BaseFieldElementT>;
+
+FieldElementT ElementFromInts(uint64_t coef0, uint64_t coef1, uint64_t coef2, uint64_t coef3) {
+  return FieldElementT(
+      BaseFieldElementT::FromUint(coef0), BaseFieldElementT::FromUint(coef1),
+      BaseFieldElementT::FromUint(coef2), BaseFieldElementT::FromUint(coef3));
+}
+
+TEST(QuarticExtensionFieldElement, Equality) {
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  const auto b = FieldElementT::RandomElement(&prng);
+  EXPECT_TRUE(a == a);
+  EXPECT_TRUE(a != b);
+}
+
+TEST(QuarticExtensionFieldElement, XToTheFourth) {
+  const auto x = ElementFromInts(0, 1, 0, 0);
+  EXPECT_EQ(x * x, ElementFromInts(0, 0, 1, 0));
+  EXPECT_EQ(x * x * x * x, FieldElementT::FromBaseFieldElement(BaseFieldElementT::Generator()));
+}
+
+TEST(QuarticExtensionFieldElement, RingAxioms) {
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  const auto b = FieldElementT::RandomElement(&prng);
+  const auto c = FieldElementT::RandomElement(&prng);
+  EXPECT_EQ(a * b, b * a);
+  EXPECT_EQ((a * b) * c, a * (b * c));
+  EXPECT_EQ(a * (b + c), a * b + a * c);
+  EXPECT_EQ(a - b + b, a);
+  EXPECT_EQ(a + (-a), FieldElementT::Zero());
+  EXPECT_EQ(a * FieldElementT::One(), a);
+}
+
+TEST(QuarticExtensionFieldElement, BaseFieldMultiplication) {
+  Prng prng;
+  const auto a = BaseFieldElementT::RandomElement(&prng);
+  const auto b = BaseFieldElementT::RandomElement(&prng);
+  EXPECT_EQ(
+      FieldElementT::FromBaseFieldElement(a) * FieldElementT::FromBaseFieldElement(b),
+      FieldElementT::FromBaseFieldElement(a * b));
+  EXPECT_TRUE(FieldElementT::FromBaseFieldElement(a).InBaseField());
+}
+
+TEST(QuarticExtensionFieldElement, Inverse) {
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  EXPECT_EQ(a * a.Inverse(), FieldElementT::One());
+  EXPECT_EQ(a.Inverse().Inverse(), a);
+  const auto b = ElementFromInts(0, 0, 7, 0);
+  EXPECT_EQ(b * b.Inverse(), FieldElementT::One());
+  EXPECT_ASSERT(
+      FieldElementT::Zero().Inverse(), testing::HasSubstr("Zero does not have an inverse"));
+}
+
+TEST(QuarticExtensionFieldElement, Frobenius) {
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  EXPECT_EQ(a.Frobenius(), Pow(a, BaseFieldElementT::kModulus));
+  EXPECT_EQ(a.Frobenius().Frobenius().Frobenius().Frobenius(), a);
+  const auto base = FieldElementT::RandomBaseElement(&prng);
+  EXPECT_EQ(base.Frobenius(), base);
+}
+
+TEST(QuarticExtensionFieldElement, Generator) {
+  using IntType = decltype(FieldElementT::FieldSize());
+  const IntType group_size = IntType::Sub(FieldElementT::FieldSize(), IntType::One()).first;
+  EXPECT_EQ(Pow(FieldElementT::Generator(), group_size.ToBoolVector()), FieldElementT::One());
+  IntType cur = group_size;
+  for (const IntType factor : FieldElementT::PrimeFactors()) {
+    const auto [quotient, remainder] = IntType::Div(group_size, factor);
+    ASSERT_EQ(remainder, IntType::Zero());
+    EXPECT_NE(Pow(FieldElementT::Generator(), quotient.ToBoolVector()), FieldElementT::One());
+    // Divide cur by factor as many times as possible, to check that the factors are complete.
+    while (IntType::Div(cur, factor).second == IntType::Zero()) {
+      cur = IntType::Div(cur, factor).first;
+    }
+  }
+  EXPECT_EQ(cur, IntType::One());
+}
+
+TEST(QuarticExtensionFieldElement, ToFromBytes) {
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  std::array<std::byte, FieldElementT::SizeInBytes()> bytes{};
+  a.ToBytes(bytes);
+  EXPECT_EQ(FieldElementT::FromBytes(bytes), a);
+}
+
+TEST(QuarticExtensionFieldElement, ToFromString) {
+  Prng prng;
+  const auto a = FieldElementT::RandomElement(&prng);
+  EXPECT_EQ(FieldElementT::FromString(a.ToString()), a);
+  EXPECT_EQ(FieldElementT::FromString("0x5"), FieldElementT::FromUint(5));
+}
+
+}  // namespace
+}  // namespace starkware
@@ -14,10 +14,68 @@
 
 #include "starkware/algebra/lde/cached_lde_manager.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <map>
+#include <tuple>
+#include <type_traits>
+
+#include "starkware/algebra/utils/invoke_template_version.h"
 
 namespace starkware {
 
+namespace {
+
+/*
+  Returns the size of the in-memory representation of an element of the given field.
+*/
+size_t ElementSizeInMemory(const Field& field) {
+  return InvokeFieldTemplateVersion(
+      [&](auto field_tag) -> size_t {
+        using FieldElementT = typename decltype(field_tag)::type;
+        return sizeof(FieldElementT);
+      },
+      field);
+}
+
+/*
+  Copies the in-memory representation of the columns to dst, one column after the other.
+*/
+void CopyColumnsToBytes(const std::vector<FieldElementVector>& columns, std::byte* dst) {
+  InvokeFieldTemplateVersion(
+      [&](auto field_tag) {
+        using FieldElementT = typename decltype(field_tag)::type;
+        static_assert(std::is_trivially_copyable_v<FieldElementT>);
+        for (const FieldElementVector& column : columns) {
+          const std::vector<FieldElementT>& values = column.As<FieldElementT>();
+          const size_t n_bytes = values.size() * sizeof(FieldElementT);
+          std::memcpy(dst, values.data(), n_bytes);
+          dst += n_bytes;
+        }
+      },
+      columns.at(0).GetField());
+}
+
+/*
+  The inverse of CopyColumnsToBytes(). The sizes of the columns must already be set.
+*/
+void CopyColumnsFromBytes(const std::byte* src, std::vector<FieldElementVector>* columns) {
+  InvokeFieldTemplateVersion(
+      [&](auto field_tag) {
+        using FieldElementT = typename decltype(field_tag)::type;
+        for (FieldElementVector& column : *columns) {
+          std::vector<FieldElementT>& values = column.As<FieldElementT>();
+          const size_t n_bytes = values.size() * sizeof(FieldElementT);
+          std::memcpy(values.data(), src, n_bytes);
+          src += n_bytes;
+        }
+      },
+      columns->at(0).GetField());
+}
+
+}  // namespace
+
 std::unique_ptr<CachedLdeManager::LdeCacheEntry> CachedLdeManager::AllocateStorage() const {
   if (config_.store_full_lde) {
     return nullptr;
@@ -31,9 +89,27 @@ const CachedLdeManager::LdeCacheEntry* CachedLdeManager::EvalOnCoset(
   ASSERT_RELEASE(coset_index < coset_offsets_->size(), "Coset index out of bounds.");
 
   if (cache_[coset_index].has_value()) {
+    if (HasBoundedCache()) {
+      Touch(coset_index);
+      AdviseNextSpilledCoset();
+    }
     return &*cache_[coset_index];
   }
 
+  if (HasBoundedCache()) {
+    Touch(coset_index);
+    LdeCacheEntry* entry = AdmitToCache(coset_index);
+    if (entry != nullptr) {
+      storage = entry;
+    }
+    if (spilled_[coset_index] != nullptr) {
+      ASSERT_RELEASE(storage != nullptr, "Invalid storage");
+      CopyColumnsFromBytes(spilled_[coset_index]->Data(), storage);
+      AdviseNextSpilledCoset();
+      return storage;
+    }
+  }
+
   const FieldElement& coset_offset = coset_offsets_->at(coset_index);
   if (coset_offset != previous_coset_offset_) {
     fft_precompute_->ShiftTwiddleFactors(coset_offset, previous_coset_offset_);
@@ -54,10 +130,104 @@ const CachedLdeManager::LdeCacheEntry* CachedLdeManager::EvalOnCoset(
       coset_offset, std::vector<FieldElementSpan>(storage->begin(), storage->end()),
       fft_precompute_.get());
 
-  // Cache if needed.
+  if (HasBoundedCache()) {
+    if (config_.spill_evicted_cosets && !cache_[coset_index].has_value()) {
+      Spill(coset_index, *storage);
+    }
+    AdviseNextSpilledCoset();
+  }
   return storage;
 }
 
+void CachedLdeManager::PrefetchHint(gsl::span<const uint64_t> coset_indices) {
+  for (const uint64_t coset_index : coset_indices) {
+    ASSERT_RELEASE(coset_index < coset_offsets_->size(), "Coset index out of bounds.");
+  }
+  hint_.assign(coset_indices.begin(), coset_indices.end());
+  hint_position_ = 0;
+  AdviseNextSpilledCoset();
+}
+
+void CachedLdeManager::Touch(uint64_t coset_index) {
+  last_use_[coset_index] = ++use_counter_;
+  if (hint_position_ < hint_.size() && hint_[hint_position_] == coset_index) {
+    hint_position_++;
+  }
+}
+
+uint64_t CachedLdeManager::NextUse(uint64_t coset_index) const {
+  for (size_t i = hint_position_; i < hint_.size(); ++i) {
+    if (hint_[i] == coset_index) {
+      return i - hint_position_;
+    }
+  }
+  return std::numeric_limits<uint64_t>::max();
+}
+
+CachedLdeManager::LdeCacheEntry* CachedLdeManager::AdmitToCache(uint64_t coset_index) {
+  if (max_cached_cosets_ == 0) {
+    return nullptr;
+  }
+  if (n_cached_cosets_ < max_cached_cosets_) {
+    n_cached_cosets_++;
+    cache_[coset_index] = InitializeEntry();
+    return &*cache_[coset_index];
+  }
+
+  // Find the cached coset that is requested last, breaking ties by the least recent use.
+  std::optional<uint64_t> victim;
+  for (uint64_t i = 0; i < cache_.size(); ++i) {
+    if (cache_[i].has_value() &&
+        (!victim.has_value() ||
+         std::make_tuple(NextUse(i), last_use_[*victim]) >
+             std::make_tuple(NextUse(*victim), last_use_[i]))) {
+      victim = i;
+    }
+  }
+  ASSERT_RELEASE(victim.has_value(), "No coset to evict.");
+  if (NextUse(coset_index) > NextUse(*victim)) {
+    return nullptr;
+  }
+
+  // Reuse the memory of the evicted coset.
+  if (config_.spill_evicted_cosets) {
+    Spill(*victim, *cache_[*victim]);
+  }
+  cache_[coset_index] = std::move(cache_[*victim]);
+  cache_[*victim].reset();
+  return &*cache_[coset_index];
+}
+
+void CachedLdeManager::Spill(uint64_t coset_index, const LdeCacheEntry& entry) {
+  if (spilled_[coset_index] != nullptr) {
+    // Cosets do not change, so there is no need to write it again.
+    return;
+  }
+  spilled_[coset_index] =
+      std::make_unique<ScratchFileMapping>(FLAGS_scratch_dir, EntrySizeInBytes());
+  CopyColumnsToBytes(entry, spilled_[coset_index]->Data());
+}
+
+void CachedLdeManager::AdviseNextSpilledCoset() const {
+  if (hint_position_ == hint_.size()) {
+    return;
+  }
+  const uint64_t next_coset = hint_[hint_position_];
+  if (!cache_[next_coset].has_value() && spilled_[next_coset] != nullptr) {
+    spilled_[next_coset]->AdviseWillNeed();
+  }
+}
+
+void CachedLdeManager::EvalOnCosetTile(
+    uint64_t coset_index, uint64_t tile_index, gsl::span<const FieldElementSpan> outputs) const {
+  ASSERT_RELEASE(done_adding_, "Must call FinalizeAdding() before calling EvalOnCosetTile()");
+  ASSERT_RELEASE(coset_index < coset_offsets_->size(), "Coset index out of bounds.");
+  ASSERT_RELEASE(outputs.size() == n_columns_, "Wrong number of output columns");
+  ASSERT_RELEASE(
+      lde_manager_.HasValue(), "Cannot evaluate new values after FinalizeEvaluations() was called");
+  lde_manager_->EvalOnCosetTile(coset_offsets_->at(coset_index), tile_index, outputs);
+}
+
 void CachedLdeManager::EvalAtPoints(
     gsl::span<const std::pair<uint64_t, uint64_t>> coset_and_point_indices,
     gsl::span<const FieldElementSpan> outputs) {
@@ -95,10 +265,26 @@ void CachedLdeManager::EvalAtPoints(
       (void)point_index;  // Unused.
       coset_to_query_index[coset_index].push_back(i);
     }
-    LdeCacheEntry entry = InitializeEntry();
+    // Visit the cached cosets first, so that they are not evicted by the others.
+    std::vector<uint64_t> coset_order;
+    coset_order.reserve(coset_to_query_index.size());
     for (const auto& [coset_index, query_indices] : coset_to_query_index) {
+      if (cache_[coset_index].has_value()) {
+        coset_order.push_back(coset_index);
+      }
+    }
+    for (const auto& [coset_index, query_indices] : coset_to_query_index) {
+      if (!cache_[coset_index].has_value()) {
+        coset_order.push_back(coset_index);
+      }
+    }
+    if (HasBoundedCache()) {
+      PrefetchHint(coset_order);
+    }
+    LdeCacheEntry entry = InitializeEntry();
+    for (const uint64_t coset_index : coset_order) {
       auto coset_evaluation = EvalOnCoset(coset_index, &entry);
-      for (size_t query_index : query_indices) {
+      for (size_t query_index : coset_to_query_index.at(coset_index)) {
         for (size_t column_index = 0; column_index < n_columns_; ++column_index) {
           const uint64_t point_index = coset_and_point_indices[query_index].second;
           outputs[column_index].Set(query_index, (*coset_evaluation)[column_index].At(point_index));
@@ -108,18 +294,54 @@ void CachedLdeManager::EvalAtPoints(
     return;
   }
 
+  // Answer the queries on cosets that happen to be cached, and evaluate the rest pointwise.
+  std::vector<size_t> uncached_queries;
+  uncached_queries.reserve(coset_and_point_indices.size());
+  for (size_t i = 0; i < coset_and_point_indices.size(); ++i) {
+    const auto& [coset_index, point_index] = coset_and_point_indices[i];
+    if (!cache_[coset_index].has_value()) {
+      uncached_queries.push_back(i);
+      continue;
+    }
+    for (size_t column_index = 0; column_index < n_columns_; ++column_index) {
+      outputs[column_index].Set(i, (*cache_[coset_index])[column_index].At(point_index));
+    }
+  }
+  if (uncached_queries.empty()) {
+    return;
+  }
+
   // Evaluate pointwise.
   ASSERT_RELEASE(
       lde_manager_.HasValue(), "Cannot evaluate new values after FinalizeEvaluations() was called");
   FieldElementVector points = FieldElementVector::Make(coset_offsets_->at(0).GetField());
-  points.Reserve(coset_and_point_indices.size());
-  for (const auto& [coset_index, point_index] : coset_and_point_indices) {
+  points.Reserve(uncached_queries.size());
+  for (const size_t query_index : uncached_queries) {
+    const auto& [coset_index, point_index] = coset_and_point_indices[query_index];
     auto domain = lde_manager_->GetDomain(coset_offsets_->at(coset_index));
     points.PushBack(domain->GetFieldElementAt(point_index));
   }
 
+  std::vector<std::pair<size_t, size_t>> column_and_point_indices;
+  column_and_point_indices.reserve(n_columns_ * points.Size());
   for (size_t column_index = 0; column_index < n_columns_; ++column_index) {
-    EvalAtPointsNotCached(column_index, points, outputs[column_index]);
+    for (size_t i = 0; i < points.Size(); ++i) {
+      column_and_point_indices.emplace_back(column_index, i);
+    }
+  }
+  FieldElementVector values =
+      FieldElementVector::MakeUninitialized(points.GetField(), column_and_point_indices.size());
+  EvalAtPointsNotCached(column_and_point_indices, points, values);
+  for (size_t column_index = 0; column_index < n_columns_; ++column_index) {
+    const auto column_values =
+        ConstFieldElementSpan(values).SubSpan(column_index * points.Size(), points.Size());
+    if (uncached_queries.size() == coset_and_point_indices.size()) {
+      outputs[column_index].CopyDataFrom(column_values);
+      continue;
+    }
+    for (size_t i = 0; i < uncached_queries.size(); ++i) {
+      outputs[column_index].Set(uncached_queries[i], column_values[i]);
+    }
   }
 }
 
@@ -130,6 +352,14 @@ void CachedLdeManager::EvalAtPointsNotCached(
   lde_manager_->EvalAtPoints(column_index, points, output);
 }
 
+void CachedLdeManager::EvalAtPointsNotCached(
+    gsl::span<const std::pair<size_t, size_t>> column_and_point_indices,
+    const ConstFieldElementSpan& points, const FieldElementSpan& output) {
+  ASSERT_RELEASE(
+      lde_manager_.HasValue(), "Cannot evaluate new values after FinalizeEvaluations() was called");
+  lde_manager_->BatchEvalAtPoints(column_and_point_indices, points, output);
+}
+
 /*void CachedLdeManager::EvalAtPointsNotCached(
     size_t column_index, const gsl::span<FieldElement>& points, const gsl::span<FieldElement>& output) {
   ASSERT_RELEASE(
@@ -137,6 +367,10 @@ void CachedLdeManager::EvalAtPointsNotCached(
   lde_manager_->EvalAtPoints(column_index, points, output);
 }*/
 
+uint64_t CachedLdeManager::EntrySizeInBytes() const {
+  return n_columns_ * domain_size_ * ElementSizeInMemory(coset_offsets_->at(0).GetField());
+}
+
 CachedLdeManager::LdeCacheEntry CachedLdeManager::InitializeEntry() const {
   LdeCacheEntry entry;
   const uint64_t coset_size = domain_size_;
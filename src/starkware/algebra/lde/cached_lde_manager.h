@@ -22,6 +22,7 @@
 
 #include "starkware/algebra/lde/lde.h"
 #include "starkware/utils/maybe_owned_ptr.h"
+#include "starkware/utils/scratch_vector.h"
 
 namespace starkware {
 
@@ -47,23 +48,43 @@ class CachedLdeManager {
       evaluation). This value has no effect when store_full_lde is true.
     */
     bool use_fft_for_eval;
+
+    /*
+      Relevant only when store_full_lde is false. If positive, each coset is split into
+      2^log_n_tiles_per_coset tiles of rows, which are computed and committed one at a time (see
+      CommittedTraceProver::Commit()), so the memory used for the LDE during the commitment is
+      reduced by this factor, at the cost of 2^log_n_tiles_per_coset additional field operations
+      per coefficient. Requires LdeManager::SupportsEvalOnCosetTile(); otherwise the cosets are
+      computed as a whole.
+      Each tile is committed as a separate segment, so the Merkle tree above the segments is
+      log_n_tiles_per_coset layers higher: n_verifier_friendly_commitment_layers must be either 0 or
+      at least log2(n_cosets) + log_n_tiles_per_coset (see CommittedTraceProver::ValidateConfig()),
+      and if n_out_of_memory_merkle_layers exceeds the height of a tile, all its layers are out of
+      memory.
+    */
+    size_t log_n_tiles_per_coset = 0;
+
+    /*
+      Relevant only when store_full_lde is false. If positive, cosets computed by EvalOnCoset() are
+      kept in memory as long as their total size is at most this number of bytes. When the cache
+      is full, the coset that will be requested last according to PrefetchHint() (or the least
+      recently used one, if there is no hint) is evicted.
+    */
+    uint64_t max_cache_bytes = 0;
+
+    /*
+      Relevant only when max_cache_bytes is positive. If true, cosets which are computed but not
+      kept in memory are written to a scratch file in --scratch_dir, and are read from it (instead
+      of being recomputed) when they are requested again.
+    */
+    bool spill_evicted_cosets = false;
   };
 
   CachedLdeManager(
       const Config& config, MaybeOwnedPtr<LdeManager> lde_manager,
       MaybeOwnedPtr<FieldElementVector> coset_offsets)
-      : lde_manager_(std::move(lde_manager)),
-        //coset_offsets_(std::move(coset_offsets)),
-        config_(config),
-        cache_(coset_offsets_->size()),
-        ifft_precompute_(lde_manager_->IfftPrecompute()),
-        previous_coset_offset_(coset_offsets->At(0)) {
-    coset_offsets_->reserve(coset_offsets->Size());
-    for(size_t i = 0; i < coset_offsets->Size(); i++)
-      coset_offsets_->push_back(FieldElement(coset_offsets->At(i)));
-    ASSERT_RELEASE(coset_offsets_->size() > 0, "At least one coset offset required");
-    domain_size_ = lde_manager_->GetDomain(coset_offsets_->at(0))->Size();
-  }
+      : CachedLdeManager(
+            config, std::move(lde_manager), UseMovedValue(ToFieldElements(*coset_offsets))) {}
 
   CachedLdeManager(
       const Config& config, MaybeOwnedPtr<LdeManager> lde_manager,
@@ -72,9 +93,14 @@ class CachedLdeManager {
         coset_offsets_(std::move(coset_offsets)),
         config_(config),
         cache_(coset_offsets_->size()),
+        last_use_(coset_offsets_->size()),
+        spilled_(coset_offsets_->size()),
         ifft_precompute_(lde_manager_->IfftPrecompute()),
         previous_coset_offset_(coset_offsets_->at(0)) {
     ASSERT_RELEASE(coset_offsets_->size() > 0, "At least one coset offset required");
+    ASSERT_RELEASE(
+        !config_.spill_evicted_cosets || !FLAGS_scratch_dir.empty(),
+        "spill_evicted_cosets requires --scratch_dir.");
     domain_size_ = lde_manager_->GetDomain(coset_offsets_->at(0))->Size();
   }
 
@@ -106,10 +132,31 @@ class CachedLdeManager {
   /*
     Evaluates an entire coset.
     If this coset is cached, a pointer to the cache is returned. Otherwise, a pointer to the storage
-    is returned.
+    is returned. When max_cache_bytes is positive, a pointer to the cache is only valid until the
+    next call to EvalOnCoset() or EvalAtPoints().
   */
   const LdeCacheEntry* EvalOnCoset(uint64_t coset_index, LdeCacheEntry* storage);
 
+  /*
+    Hints that the given cosets are about to be requested by EvalOnCoset(), in this order. Replaces
+    the previous hint. Relevant only when max_cache_bytes is positive: the cache keeps the cosets
+    that are requested soonest, and the next spilled coset is read ahead from its scratch file.
+  */
+  void PrefetchHint(gsl::span<const uint64_t> coset_indices);
+
+  /*
+    Returns true if EvalOnCosetTile() is supported. See LdeManager::SupportsEvalOnCosetTile().
+  */
+  bool SupportsEvalOnCosetTile() const { return lde_manager_->SupportsEvalOnCosetTile(); }
+
+  /*
+    Evaluates the rows [tile_index * tile_size, (tile_index + 1) * tile_size) of a coset, where
+    tile_size is the size of each of the outputs (one per column). The cache is neither used nor
+    filled. See LdeManager::EvalOnCosetTile().
+  */
+  void EvalOnCosetTile(
+      uint64_t coset_index, uint64_t tile_index, gsl::span<const FieldElementSpan> outputs) const;
+
   /*
     Evaluates all columns at point. Cached version, takes pairs of (coset_index, point_index).
   */
@@ -123,6 +170,15 @@ class CachedLdeManager {
   void EvalAtPointsNotCached(
       size_t column_index, const ConstFieldElementSpan& points, const FieldElementSpan& output);
 
+  /*
+    Same as above, for several columns. For every i, output[i] is the value of column
+    column_and_point_indices[i].first at points[column_and_point_indices[i].second]. The
+    coefficients of all the columns are read together (see LdeManager::BatchEvalAtPoints()).
+  */
+  void EvalAtPointsNotCached(
+      gsl::span<const std::pair<size_t, size_t>> column_and_point_indices,
+      const ConstFieldElementSpan& points, const FieldElementSpan& output);
+
 //  void EvalAtPointsNotCached(
 //      size_t column_index, const gsl::span<FieldElement>& points, const gsl::span<FieldElement>& output);
   /*
@@ -140,6 +196,9 @@ class CachedLdeManager {
     ASSERT_RELEASE(!done_adding_, "FinalizeAdding called twice.");
     ifft_precompute_.reset(nullptr);
     fft_precompute_ = lde_manager_->FftPrecompute(coset_offsets_->at(0));
+    if (HasBoundedCache()) {
+      max_cached_cosets_ = config_.max_cache_bytes / EntrySizeInBytes();
+    }
 
     done_adding_ = true;
   }
@@ -160,6 +219,52 @@ class CachedLdeManager {
   */
   LdeCacheEntry InitializeEntry() const;
 
+  /*
+    Returns the number of bytes of the values of all the columns on one coset.
+  */
+  uint64_t EntrySizeInBytes() const;
+
+  /*
+    Returns true if computed cosets are kept in a bounded cache (see Config::max_cache_bytes).
+  */
+  bool HasBoundedCache() const { return !config_.store_full_lde && config_.max_cache_bytes > 0; }
+
+  /*
+    Records that coset_index was requested, for the eviction policy.
+  */
+  void Touch(uint64_t coset_index);
+
+  /*
+    Returns the number of hinted requests before the next request of coset_index, or the maximal
+    uint64_t if it is not in the hint.
+  */
+  uint64_t NextUse(uint64_t coset_index) const;
+
+  /*
+    Makes room for coset_index in the bounded cache, evicting another coset if needed, and returns
+    the entry to fill. Returns nullptr if coset_index should not be kept in memory.
+  */
+  LdeCacheEntry* AdmitToCache(uint64_t coset_index);
+
+  /*
+    Writes an entry to the scratch file of coset_index, unless it was already written.
+  */
+  void Spill(uint64_t coset_index, const LdeCacheEntry& entry);
+
+  /*
+    Hints the OS to read the scratch file of the next hinted coset, if it is needed.
+  */
+  void AdviseNextSpilledCoset() const;
+
+  static std::vector<FieldElement> ToFieldElements(const FieldElementVector& vec) {
+    std::vector<FieldElement> res;
+    res.reserve(vec.Size());
+    for (size_t i = 0; i < vec.Size(); ++i) {
+      res.push_back(vec[i]);
+    }
+    return res;
+  }
+
   MaybeOwnedPtr<LdeManager> lde_manager_;
   MaybeOwnedPtr<std::vector<FieldElement>> coset_offsets_;
   uint64_t domain_size_;
@@ -172,6 +277,19 @@ class CachedLdeManager {
   */
   std::vector<std::optional<LdeCacheEntry>> cache_;
 
+  /*
+    State of the bounded cache (see Config::max_cache_bytes). last_use_[i] is the value of
+    use_counter_ when coset i was last requested, and hint_[hint_position_:] are the cosets that are
+    expected to be requested next. spilled_[i] holds coset i if it was spilled.
+  */
+  size_t max_cached_cosets_ = 0;
+  size_t n_cached_cosets_ = 0;
+  uint64_t use_counter_ = 0;
+  std::vector<uint64_t> last_use_;
+  std::vector<uint64_t> hint_;
+  size_t hint_position_ = 0;
+  std::vector<std::unique_ptr<ScratchFileMapping>> spilled_;
+
   /*
     Saves precompute (which contains twiddle factors) and previous coset offset, in order to quickly
     update the previous twiddle factors to the new twiddle factors. This is done by multiplying the
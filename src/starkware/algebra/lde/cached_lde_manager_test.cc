@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "gmock/gmock.h"
@@ -25,6 +26,7 @@
 #include "starkware/algebra/lde/lde_manager_mock.h"
 #include "starkware/algebra/polymorphic/test_utils.h"
 #include "starkware/error_handling/test_utils.h"
+#include "starkware/utils/scratch_vector_test_utils.h"
 
 namespace starkware {
 namespace {
@@ -101,6 +103,23 @@ class CachedLdeManagerTest : public ::testing::Test {
   */
   void StartTest(bool store_full_lde, bool use_fft_for_eval);
 
+  /*
+    Same as above, with a given config. If hint is not empty, it is passed to PrefetchHint() before
+    the cosets are evaluated.
+  */
+  void StartTest(const CachedLdeManager::Config& config, const std::vector<uint64_t>& hint = {});
+
+  /*
+    Returns the number of bytes of one coset of all the columns.
+  */
+  uint64_t CosetSizeInBytes() const { return n_columns_ * coset_size_ * sizeof(TestFieldElement); }
+
+  /*
+    Calls EvalOnCoset() and checks the result. If expect_computation is true, expects the coset to
+    be computed by the underlying LdeManager, and otherwise expects it not to be.
+  */
+  void TestEvalOnCoset(uint64_t coset_index, bool expect_computation);
+
   void TestEvalAtPointsResult(
       const std::vector<std::pair<size_t, uint64_t>>& coset_point_indices,
       const std::vector<FieldElementVector>& outputs);
@@ -112,8 +131,12 @@ class CachedLdeManagerTest : public ::testing::Test {
 };
 
 void CachedLdeManagerTest::StartTest(bool store_full_lde, bool use_fft_for_eval) {
-  CachedLdeManager::Config config{/*store_full_lde=*/store_full_lde,
-                                  /*use_fft_for_eval=*/use_fft_for_eval};
+  StartTest(CachedLdeManager::Config{/*store_full_lde=*/store_full_lde,
+                                     /*use_fft_for_eval=*/use_fft_for_eval});
+}
+
+void CachedLdeManagerTest::StartTest(
+    const CachedLdeManager::Config& config, const std::vector<uint64_t>& hint) {
   cached_lde_manager_.emplace(
       config,
       /*lde_manager=*/UseOwned(&lde_manager_),
@@ -128,6 +151,9 @@ void CachedLdeManagerTest::StartTest(bool store_full_lde, bool use_fft_for_eval)
     cached_lde_manager_->AddEvaluation(std::move(evaluation));
   }
   cached_lde_manager_->FinalizeAdding();
+  if (!hint.empty()) {
+    cached_lde_manager_->PrefetchHint(hint);
+  }
 
   // Evaluate cosets once.
   auto storage = cached_lde_manager_->AllocateStorage();
@@ -217,6 +243,97 @@ TEST_F(CachedLdeManagerTest, EvalOnCoset_NoCache) {
   }
 }
 
+void CachedLdeManagerTest::TestEvalOnCoset(uint64_t coset_index, bool expect_computation) {
+  EXPECT_CALL(lde_manager_, EvalOnCoset(FieldElement(offsets_[coset_index]), _, _))
+      .Times(expect_computation ? 1 : 0)
+      .WillRepeatedly(SetEvaluation(evaluations_[coset_index]));
+  auto storage = cached_lde_manager_->AllocateStorage();
+  auto result = cached_lde_manager_->EvalOnCoset(coset_index, storage.get());
+  ASSERT_EQ(result->size(), n_columns_);
+  for (size_t column_index = 0; column_index < n_columns_; ++column_index) {
+    ASSERT_EQ(
+        (*result)[column_index].As<TestFieldElement>(), evaluations_[coset_index][column_index]);
+  }
+  testing::Mock::VerifyAndClearExpectations(&lde_manager_);
+}
+
+TEST_F(CachedLdeManagerTest, EvalOnCoset_BoundedCache) {
+  // Room for two cosets and a half.
+  StartTest(CachedLdeManager::Config{
+      /*store_full_lde=*/false,
+      /*use_fft_for_eval=*/false,
+      /*log_n_tiles_per_coset=*/0,
+      /*max_cache_bytes=*/CosetSizeInBytes() * 5 / 2,
+  });
+
+  // The last two cosets are cached. The least recently used coset is evicted.
+  TestEvalOnCoset(9, /*expect_computation=*/false);
+  TestEvalOnCoset(8, /*expect_computation=*/false);
+  TestEvalOnCoset(0, /*expect_computation=*/true);
+  TestEvalOnCoset(8, /*expect_computation=*/false);
+  TestEvalOnCoset(9, /*expect_computation=*/true);
+  TestEvalOnCoset(8, /*expect_computation=*/false);
+  TestEvalOnCoset(0, /*expect_computation=*/true);
+}
+
+TEST_F(CachedLdeManagerTest, EvalOnCoset_BoundedCacheWithHint) {
+  // Announce that the cosets will be requested twice, in order.
+  std::vector<uint64_t> hint;
+  for (size_t i = 0; i < 2 * n_cosets_; ++i) {
+    hint.push_back(i % n_cosets_);
+  }
+  StartTest(
+      CachedLdeManager::Config{
+          /*store_full_lde=*/false,
+          /*use_fft_for_eval=*/false,
+          /*log_n_tiles_per_coset=*/0,
+          /*max_cache_bytes=*/CosetSizeInBytes() * 2,
+      },
+      hint);
+
+  // The first cosets are kept, since they are requested before the others.
+  TestEvalOnCoset(0, /*expect_computation=*/false);
+  TestEvalOnCoset(1, /*expect_computation=*/false);
+  TestEvalOnCoset(2, /*expect_computation=*/true);
+
+  // Cosets 1 and 2 are cached. Coset 1 is the least recently used one, but it is requested right
+  // after coset 3, so coset 2 is evicted instead.
+  cached_lde_manager_->PrefetchHint(std::vector<uint64_t>{3, 1});
+  TestEvalOnCoset(3, /*expect_computation=*/true);
+  TestEvalOnCoset(1, /*expect_computation=*/false);
+  TestEvalOnCoset(2, /*expect_computation=*/true);
+}
+
+TEST_F(CachedLdeManagerTest, EvalOnCoset_SpillEvictedCosets) {
+  ScopedScratchDir scratch_dir(::testing::TempDir());
+  StartTest(CachedLdeManager::Config{
+      /*store_full_lde=*/false,
+      /*use_fft_for_eval=*/false,
+      /*log_n_tiles_per_coset=*/0,
+      /*max_cache_bytes=*/CosetSizeInBytes(),
+      /*spill_evicted_cosets=*/true,
+  });
+
+  // Every coset is either cached or read from its scratch file.
+  for (uint64_t coset_index = 0; coset_index < n_cosets_; ++coset_index) {
+    TestEvalOnCoset(coset_index, /*expect_computation=*/false);
+  }
+  TestEvalOnCoset(0, /*expect_computation=*/false);
+}
+
+TEST_F(CachedLdeManagerTest, SpillWithoutScratchDir) {
+  ScopedScratchDir scratch_dir("");
+  CachedLdeManager::Config config{/*store_full_lde=*/false,
+                                  /*use_fft_for_eval=*/false,
+                                  /*log_n_tiles_per_coset=*/0,
+                                  /*max_cache_bytes=*/CosetSizeInBytes(),
+                                  /*spill_evicted_cosets=*/true};
+  EXPECT_ASSERT(
+      cached_lde_manager_.emplace(
+          config, UseOwned(&lde_manager_), UseMovedValue(FieldElementVector::CopyFrom(offsets_))),
+      HasSubstr("requires --scratch_dir"));
+}
+
 void CachedLdeManagerTest::TestEvalAtPointsResult(
     const std::vector<std::pair<size_t, uint64_t>>& coset_point_indices,
     const std::vector<FieldElementVector>& outputs) {
@@ -345,6 +462,39 @@ TEST_F(CachedLdeManagerTest, EvalAtPoints_NoCacheFft) {
   TestEvalAtPointsResult(coset_point_indices, outputs);
 }
 
+TEST_F(CachedLdeManagerTest, EvalAtPoints_BoundedCacheNoFft) {
+  StartTest(CachedLdeManager::Config{
+      /*store_full_lde=*/false,
+      /*use_fft_for_eval=*/false,
+      /*log_n_tiles_per_coset=*/0,
+      /*max_cache_bytes=*/CosetSizeInBytes() * 2,
+  });
+
+  // Cosets 8 and 9 are cached, and coset 0 is not.
+  const std::vector<std::pair<size_t, uint64_t>> coset_point_indices = {
+      {8, 3}, {0, 5}, {9, 0}, {0, 15}, {8, 7}};
+  const std::vector<TestFieldElement> expected_points = {
+      domain_.GetShiftedDomain(offsets_[0])[5], domain_.GetShiftedDomain(offsets_[0])[15]};
+  std::vector<FieldElementVector> outputs;
+  for (size_t column_index = 0; column_index < n_columns_; column_index++) {
+    outputs.push_back(FieldElementVector::MakeUninitialized(
+        Field::Create<TestFieldElement>(), coset_point_indices.size()));
+    // Only the points on coset 0 are evaluated.
+    const std::vector<TestFieldElement> expected_eval = {
+        evaluations_[0][column_index][5], evaluations_[0][column_index][15]};
+    EXPECT_CALL(
+        lde_manager_,
+        EvalAtPoints(
+            column_index, IsFieldElementVector<TestFieldElement>(ElementsAreArray(expected_points)),
+            _))
+        .WillOnce(SetPointsEvaluation(expected_eval));
+  }
+  std::vector<FieldElementSpan> outputs_spans = {outputs.begin(), outputs.end()};
+  cached_lde_manager_->EvalAtPoints(coset_point_indices, outputs_spans);
+
+  TestEvalAtPointsResult(coset_point_indices, outputs);
+}
+
 TEST_F(CachedLdeManagerTest, AddAfterEvalOnCoset) {
   StartTest(/*store_full_lde=*/true, /*use_fft_for_eval=*/false);
 
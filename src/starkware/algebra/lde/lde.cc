@@ -14,14 +14,17 @@
 
 #include "starkware/algebra/lde/lde.h"
 
+#include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "starkware/algebra/domains/multiplicative_group.h"
 #include "starkware/algebra/fft/fft_with_precompute.h"
 #include "starkware/algebra/field_operations.h"
 #include "starkware/algebra/fields/test_field_element.h"
 #include "starkware/algebra/lde/lde_manager_impl.h"
+#include "starkware/algebra/polymorphic/field_element_vector.h"
 #include "starkware/algebra/polynomials.h"
 #include "starkware/algebra/utils/invoke_template_version.h"
 #include "starkware/utils/bit_reversal.h"
@@ -30,6 +33,41 @@
 
 namespace starkware {
 
+void LdeManager::BatchEvalAtPoints(
+    gsl::span<const std::pair<size_t, size_t>> queries, const ConstFieldElementSpan& points,
+    const FieldElementSpan& outputs) const {
+  ASSERT_RELEASE(
+      outputs.Size() == queries.size(),
+      "The number of outputs must be the same as the number of queries.");
+
+  // Group the queries by evaluation.
+  std::map<size_t, std::vector<size_t>> queries_per_evaluation;
+  for (size_t query_idx = 0; query_idx < queries.size(); ++query_idx) {
+    queries_per_evaluation[queries[query_idx].first].push_back(query_idx);
+  }
+
+  const Field field = points.GetField();
+  for (const auto& [evaluation_idx, query_indices] : queries_per_evaluation) {
+    FieldElementVector evaluation_points = FieldElementVector::Make(field);
+    evaluation_points.Reserve(query_indices.size());
+    for (const size_t query_idx : query_indices) {
+      evaluation_points.PushBack(points[queries[query_idx].second]);
+    }
+    FieldElementVector evaluation_outputs =
+        FieldElementVector::MakeUninitialized(field, query_indices.size());
+    EvalAtPoints(evaluation_idx, evaluation_points, evaluation_outputs);
+    for (size_t i = 0; i < query_indices.size(); ++i) {
+      outputs.Set(query_indices[i], evaluation_outputs[i]);
+    }
+  }
+}
+
+void LdeManager::EvalOnCosetTile(
+    const FieldElement& /* coset_offset */, uint64_t /* tile_index */,
+    gsl::span<const FieldElementSpan> /* evaluation_results */) const {
+  ASSERT_RELEASE(false, "EvalOnCosetTile() is not supported by this LdeManager.");
+}
+
 std::unique_ptr<LdeManager> MakeLdeManager(const FftBases& bases) {
   return InvokeFieldTemplateVersion(
       [&](auto field_tag) -> std::unique_ptr<LdeManager> {
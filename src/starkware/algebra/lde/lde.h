@@ -66,6 +66,23 @@ class LdeManager {
       const FieldElement& coset_offset,
       gsl::span<const FieldElementSpan> evaluation_results) const = 0;
 
+  /*
+    Returns true if EvalOnCosetTile() is supported. This is the case when the coset evaluation is in
+    bit reversed order, where each aligned range of rows is a coset of a smaller subgroup.
+  */
+  virtual bool SupportsEvalOnCosetTile() const { return false; }
+
+  /*
+    Evaluates a tile of EvalOnCoset(coset_offset, ...): the rows
+    [tile_index * tile_size, (tile_index + 1) * tile_size), where tile_size is the size of each of
+    the evaluation_results, and must be a power of two that divides the coset size.
+    The rest of the coset is not computed. The cost is an FFT of size tile_size, and a linear pass
+    over the coefficients, per evaluation.
+  */
+  virtual void EvalOnCosetTile(
+      const FieldElement& coset_offset, uint64_t tile_index,
+      gsl::span<const FieldElementSpan> evaluation_results) const;
+
   /*
     Constructs an LDE from the coefficients of the polynomial (obtained by GetCoefficients()).
   */
@@ -75,6 +92,17 @@ class LdeManager {
       size_t evaluation_idx, const ConstFieldElementSpan& points,
       const FieldElementSpan& outputs) const = 0;
 
+  /*
+    Evaluates several evaluations at several points. For every i, outputs[i] is the value of the
+    interpolation polynomial of evaluation queries[i].first at points[queries[i].second].
+
+    The default implementation calls EvalAtPoints() once per evaluation. Implementations may
+    override it to read the coefficients of all the evaluations together.
+  */
+  virtual void BatchEvalAtPoints(
+      gsl::span<const std::pair<size_t, size_t>> queries, const ConstFieldElementSpan& points,
+      const FieldElementSpan& outputs) const;
+
   /*
     Returns the degree of the interpolation polynomial for Evaluation that was previously added
     through AddEvaluation().
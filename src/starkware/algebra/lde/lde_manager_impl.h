@@ -16,6 +16,7 @@
 #define STARKWARE_ALGEBRA_LDE_LDE_MANAGER_IMPL_H_
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "starkware/algebra/lde/lde.h"
@@ -48,6 +49,12 @@ class LdeManagerTmpl : public LdeManager {
       const FieldElement& coset_offset,
       gsl::span<const FieldElementSpan> evaluation_results) const override;
 
+  bool SupportsEvalOnCosetTile() const override;
+
+  void EvalOnCosetTile(
+      const FieldElement& coset_offset, uint64_t tile_index,
+      gsl::span<const FieldElementSpan> evaluation_results) const override;
+
   void AddFromCoefficients(const ConstFieldElementSpan& coefficients) override;
 
   std::unique_ptr<FftWithPrecomputeBase> FftPrecompute(
@@ -58,6 +65,14 @@ class LdeManagerTmpl : public LdeManager {
       size_t evaluation_idx, const ConstFieldElementSpan& points,
       const FieldElementSpan& outputs) const override;
 
+  /*
+    Evaluates all the queries with MultiPolynomialBatchHornerEval() (or its bit reversed variant),
+    which reads the coefficients of all the evaluations in a single pass.
+  */
+  void BatchEvalAtPoints(
+      gsl::span<const std::pair<size_t, size_t>> queries, const ConstFieldElementSpan& points,
+      const FieldElementSpan& outputs) const override;
+
   int64_t GetEvaluationDegree(size_t evaluation_idx) const override;
 
   ConstFieldElementSpan GetCoefficients(size_t evaluation_idx) const override;
@@ -17,7 +17,9 @@
 
 #include "third_party/cppitertools/zip.hpp"
 
+#include "starkware/algebra/fft/fast_polynomials.h"
 #include "starkware/algebra/lde/multiplicative_lde.h"
+#include "starkware/algebra/polynomials.h"
 #include "starkware/utils/profiling.h"
 
 namespace starkware {
@@ -107,6 +109,52 @@ void LdeManagerTmpl<LdeT>::EvalOnCoset(
   EvalOnCoset(coset_offset, evaluation_results, nullptr);
 }
 
+template <typename LdeT>
+bool LdeManagerTmpl<LdeT>::SupportsEvalOnCosetTile() const {
+  return LdeT::kOrder == MultiplicativeGroupOrdering::kBitReversedOrder;
+}
+
+template <typename LdeT>
+void LdeManagerTmpl<LdeT>::EvalOnCosetTile(
+    const FieldElement& coset_offset, uint64_t tile_index,
+    gsl::span<const FieldElementSpan> evaluation_results) const {
+  ASSERT_RELEASE(
+      SupportsEvalOnCosetTile(), "EvalOnCosetTile() requires an LDE in bit reversed order.");
+  ASSERT_RELEASE(
+      ldes_vector_.size() == evaluation_results.size(),
+      "evaluation_results.size() must match number of LDEs.");
+  if (evaluation_results.empty()) {
+    return;
+  }
+
+  const uint64_t tile_size = evaluation_results[0].Size();
+  for (const auto& column : evaluation_results) {
+    ASSERT_RELEASE(column.Size() == tile_size, "Wrong column output size");
+  }
+  const size_t log_tile_size = SafeLog2(tile_size);
+  ASSERT_RELEASE(tile_size <= lde_size_, "Tile is larger than the coset");
+  ASSERT_RELEASE(tile_index < SafeDiv(lde_size_, tile_size), "Tile index out of range");
+
+  // In bit reversed order, the first log_tile_size basis elements span the subgroup of size
+  // tile_size, and the rest of the basis elements determine the offset of the tile.
+  const auto& domain = bases_[0];
+  const FieldElementT tile_offset = domain.GetShiftedDomain(
+      coset_offset.As<FieldElementT>() * offset_compensation_)[tile_index * tile_size];
+  const FieldElementT generator =
+      log_tile_size > 0 ? domain.Basis()[log_tile_size - 1] : FieldElementT::One();
+  const typename LdeT::PrecomputeType tile_precompute(
+      BasesT(generator, log_tile_size, tile_offset));
+
+  TaskManager::GetInstance().ParallelFor(
+      ldes_vector_.size(),
+      [&tile_precompute, &tile_offset, &ldes = this->ldes_vector_,
+       evaluation_results](const TaskInfo& task_info) {
+        size_t idx = task_info.start_idx;
+        ldes[idx].EvalAtCosetTile(
+            tile_precompute, tile_offset, evaluation_results[idx].template As<FieldElementT>());
+      });
+}
+
 template <typename LdeT>
 void LdeManagerTmpl<LdeT>::AddFromCoefficients(const ConstFieldElementSpan& coefficients) {
   ASSERT_RELEASE(
@@ -137,6 +185,47 @@ void LdeManagerTmpl<LdeT>::EvalAtPoints(
   ldes_vector_[evaluation_idx].EvalAtPoints(fixed_points, outputs);
 }
 
+template <typename LdeT>
+void LdeManagerTmpl<LdeT>::BatchEvalAtPoints(
+    gsl::span<const std::pair<size_t, size_t>> queries, const ConstFieldElementSpan& points,
+    const FieldElementSpan& outputs) const {
+  // Evaluations with many points are better served by the fast multipoint evaluation of
+  // EvalAtPoints().
+  std::vector<size_t> n_queries_per_evaluation(ldes_vector_.size(), 0);
+  for (const auto& query : queries) {
+    ASSERT_RELEASE(query.first < ldes_vector_.size(), "evaluation_idx out of range.");
+    n_queries_per_evaluation[query.first]++;
+  }
+  for (size_t evaluation_idx = 0; evaluation_idx < ldes_vector_.size(); ++evaluation_idx) {
+    if (ShouldUseFastMultipointEval<FieldElementT>(
+            ldes_vector_[evaluation_idx].GetCoefficients().size(),
+            n_queries_per_evaluation[evaluation_idx])) {
+      LdeManager::BatchEvalAtPoints(queries, points, outputs);
+      return;
+    }
+  }
+
+  std::vector<gsl::span<const FieldElementT>> polynomials;
+  polynomials.reserve(ldes_vector_.size());
+  for (const LdeT& lde : ldes_vector_) {
+    polynomials.emplace_back(lde.GetCoefficients());
+  }
+  std::vector<FieldElementT> fixed_points;
+  fixed_points.reserve(points.Size());
+  for (const FieldElementT& point : points.As<FieldElementT>()) {
+    fixed_points.push_back(point * offset_compensation_);
+  }
+
+  // A natural order LDE stores its coefficients in bit reversed order and vice versa.
+  if constexpr (LdeT::kOrder == MultiplicativeGroupOrdering::kNaturalOrder) {
+    MultiPolynomialBatchHornerEvalBitReversed<FieldElementT>(
+        fixed_points, polynomials, queries, outputs.As<FieldElementT>());
+  } else {
+    MultiPolynomialBatchHornerEval<FieldElementT>(
+        fixed_points, polynomials, queries, outputs.As<FieldElementT>());
+  }
+}
+
 template <typename LdeT>
 int64_t LdeManagerTmpl<LdeT>::GetEvaluationDegree(size_t evaluation_idx) const {
   ASSERT_RELEASE(evaluation_idx < ldes_vector_.size(), "evaluation_idx out of range.");
@@ -291,6 +291,63 @@ TYPED_TEST(PrimeFieldLdeTest, EvalAtPoint) {
   EvalAtPointTest<MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>(4);
   EvalAtPointTest<MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>(1);
   EvalAtPointTest<MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>(0);
+
+  // Large enough to use FastMultipointEval().
+  EvalAtPointTest<MultiplicativeGroupOrdering::kNaturalOrder, FieldElementT>(12);
+  EvalAtPointTest<MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>(12);
+}
+
+template <MultiplicativeGroupOrdering Order, typename FieldElementT>
+void BatchEvalAtPointsTest(const size_t log_domain_size) {
+  const Field field = Field::Create<FieldElementT>();
+  Prng prng;
+
+  const size_t domain_size = Pow2(log_domain_size);
+  const MultiplicativeGroup group = MultiplicativeGroup::MakeGroup(domain_size, field);
+  auto source_eval_offset = FieldElement(FieldElementT::RandomElement(&prng));
+  auto lde_manager = Order == MultiplicativeGroupOrdering::kNaturalOrder
+                         ? MakeLdeManager(group, source_eval_offset)
+                         : MakeBitReversedOrderLdeManager(group, source_eval_offset);
+  const size_t n_evaluations = 3;
+  for (size_t i = 0; i < n_evaluations; ++i) {
+    lde_manager->AddEvaluation(
+        FieldElementVector::Make(prng.RandomFieldElementVector<FieldElementT>(domain_size)));
+  }
+
+  const size_t n_points = 5;
+  const auto points = prng.RandomFieldElementVector<FieldElementT>(n_points);
+  std::vector<std::pair<size_t, size_t>> queries;
+  for (size_t i = 0; i < 12; ++i) {
+    queries.emplace_back(
+        prng.UniformInt<size_t>(0, n_evaluations - 1), prng.UniformInt<size_t>(0, n_points - 1));
+  }
+
+  std::vector<FieldElementT> results(queries.size(), FieldElementT::Zero());
+  lde_manager->BatchEvalAtPoints(
+      queries, ConstFieldElementSpan(gsl::span<const FieldElementT>(points)),
+      FieldElementSpan(gsl::make_span(results)));
+
+  for (size_t i = 0; i < queries.size(); ++i) {
+    const auto& [evaluation_idx, point_idx] = queries[i];
+    FieldElementT expected = FieldElementT::Zero();
+    lde_manager->EvalAtPoints(
+        evaluation_idx,
+        ConstFieldElementSpan(gsl::span<const FieldElementT>(&points[point_idx], 1)),
+        FieldElementSpan(gsl::make_span(&expected, 1)));
+    EXPECT_EQ(results[i], expected);
+  }
+}
+
+TYPED_TEST(PrimeFieldLdeTest, BatchEvalAtPoints) {
+  using FieldElementT = TypeParam;
+  BatchEvalAtPointsTest<MultiplicativeGroupOrdering::kNaturalOrder, FieldElementT>(0);
+  BatchEvalAtPointsTest<MultiplicativeGroupOrdering::kNaturalOrder, FieldElementT>(4);
+  BatchEvalAtPointsTest<MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>(0);
+  BatchEvalAtPointsTest<MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>(4);
+
+  // Large enough to be split into several chunks.
+  BatchEvalAtPointsTest<MultiplicativeGroupOrdering::kNaturalOrder, FieldElementT>(15);
+  BatchEvalAtPointsTest<MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>(15);
 }
 
 template <MultiplicativeGroupOrdering Order, typename FieldElementT>
@@ -325,6 +382,49 @@ void TestAddFromAndGetCoefficients() {
   EXPECT_EQ(expected_output, output);
 }
 
+template <MultiplicativeGroupOrdering Order, typename FieldElementT>
+void TestEvalAtPointsZeroPaddedCoefficients() {
+  Prng prng;
+  const size_t n = 64;
+  const size_t degree_bound = 5;
+
+  std::vector<FieldElementT> coefs(n, FieldElementT::Zero());
+  for (size_t i = 0; i < degree_bound; ++i) {
+    // Order == kNaturalOrder stores the coefficients in bit reversed order.
+    coefs[Order == MultiplicativeGroupOrdering::kNaturalOrder ? BitReverse(i, SafeLog2(n)) : i] =
+        FieldElementT::RandomElement(&prng);
+  }
+  FieldElementT source_eval_offset = FieldElementT::RandomElement(&prng);
+
+  MultiplicativeGroup group = MultiplicativeGroup::MakeGroup(n, Field::Create<FieldElementT>());
+  auto lde_manager = Order == MultiplicativeGroupOrdering::kNaturalOrder
+                         ? MakeLdeManager(group, FieldElement(source_eval_offset))
+                         : MakeBitReversedOrderLdeManager(group, FieldElement(source_eval_offset));
+  lde_manager->AddFromCoefficients(FieldElementVector::CopyFrom(coefs));
+
+  const std::vector<FieldElementT> points = prng.RandomFieldElementVector<FieldElementT>(10);
+  std::vector<FieldElementT> outputs(points.size(), FieldElementT::Zero());
+  lde_manager->EvalAtPoints(
+      0, ConstFieldElementSpan(gsl::make_span(points)), FieldElementSpan(gsl::make_span(outputs)));
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    const FieldElementT fixed_point = points[i] / source_eval_offset;
+    EXPECT_EQ(
+        Order == MultiplicativeGroupOrdering::kNaturalOrder
+            ? HornerEvalBitReversed(fixed_point, coefs)
+            : HornerEval(fixed_point, coefs),
+        outputs[i]);
+  }
+}
+
+TYPED_TEST(PrimeFieldLdeTest, EvalAtPointsZeroPaddedCoefficients) {
+  using FieldElementT = TypeParam;
+  TestEvalAtPointsZeroPaddedCoefficients<
+      MultiplicativeGroupOrdering::kNaturalOrder, FieldElementT>();
+  TestEvalAtPointsZeroPaddedCoefficients<
+      MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>();
+}
+
 TYPED_TEST(PrimeFieldLdeTest, AddFromAndGetCoefficients) {
   using FieldElementT = TypeParam;
   TestAddFromAndGetCoefficients<MultiplicativeGroupOrdering::kNaturalOrder, FieldElementT>();
@@ -335,5 +435,60 @@ TYPED_TEST(PrimeFieldLdeTest, AddFromAndGetCoefficients_BitReversal) {
   TestAddFromAndGetCoefficients<MultiplicativeGroupOrdering::kBitReversedOrder, FieldElementT>();
 }
 
+TYPED_TEST(PrimeFieldLdeTest, EvalOnCosetTile) {
+  using FieldElementT = TypeParam;
+  const Field field = Field::Create<FieldElementT>();
+  Prng prng;
+
+  const size_t log_domain_size = 6;
+  const size_t domain_size = Pow2(log_domain_size);
+  const MultiplicativeGroup group = MultiplicativeGroup::MakeGroup(domain_size, field);
+  const auto source_eval_offset = FieldElement(FieldElementT::RandomElement(&prng));
+
+  EXPECT_FALSE(MakeLdeManager(group, source_eval_offset)->SupportsEvalOnCosetTile());
+  auto lde_manager = MakeBitReversedOrderLdeManager(group, source_eval_offset);
+  ASSERT_TRUE(lde_manager->SupportsEvalOnCosetTile());
+
+  const size_t n_evaluations = 3;
+  for (size_t i = 0; i < n_evaluations; ++i) {
+    lde_manager->AddEvaluation(
+        FieldElementVector::Make(prng.RandomFieldElementVector<FieldElementT>(domain_size)));
+  }
+
+  const auto eval_offset = FieldElement(FieldElementT::RandomElement(&prng));
+  std::vector<FieldElementVector> coset;
+  for (size_t i = 0; i < n_evaluations; ++i) {
+    coset.push_back(FieldElementVector::MakeUninitialized(field, domain_size));
+  }
+  lde_manager->EvalOnCoset(eval_offset, std::vector<FieldElementSpan>(coset.begin(), coset.end()));
+
+  for (size_t log_tile_size = 0; log_tile_size <= log_domain_size; ++log_tile_size) {
+    const size_t tile_size = Pow2(log_tile_size);
+    for (size_t tile_index = 0; tile_index < domain_size / tile_size; ++tile_index) {
+      std::vector<FieldElementVector> tile;
+      for (size_t i = 0; i < n_evaluations; ++i) {
+        tile.push_back(FieldElementVector::MakeUninitialized(field, tile_size));
+      }
+      lde_manager->EvalOnCosetTile(
+          eval_offset, tile_index, std::vector<FieldElementSpan>(tile.begin(), tile.end()));
+      for (size_t i = 0; i < n_evaluations; ++i) {
+        EXPECT_EQ(
+            tile[i], FieldElementVector::CopyFrom(ConstFieldElementSpan(coset[i]).SubSpan(
+                         tile_index * tile_size, tile_size)));
+      }
+    }
+  }
+
+  // Tile size must be a power of two.
+  std::vector<FieldElementVector> bad_tile;
+  for (size_t i = 0; i < n_evaluations; ++i) {
+    bad_tile.push_back(FieldElementVector::MakeUninitialized(field, 3));
+  }
+  EXPECT_ASSERT(
+      lde_manager->EvalOnCosetTile(
+          eval_offset, 0, std::vector<FieldElementSpan>(bad_tile.begin(), bad_tile.end())),
+      testing::HasSubstr("power of 2"));
+}
+
 }  // namespace
 }  // namespace starkware
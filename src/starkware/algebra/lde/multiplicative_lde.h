@@ -47,6 +47,16 @@ class MultiplicativeLde {
   void EvalAtCoset(
       const FftWithPrecompute<BasesT>& fft_precompute, gsl::span<FieldElementT> result) const;
 
+  /*
+    Evaluates the polynomial on a coset of a subgroup of size result.size(), given by
+    fft_precompute, whose offset is tile_offset. The polynomial is first reduced modulo
+    x^result.size() - tile_offset^result.size(), which vanishes on that coset.
+    Only supported for kBitReversedOrder, where the coefficients are in natural order.
+  */
+  void EvalAtCosetTile(
+      const FftWithPrecompute<BasesT>& fft_precompute, const FieldElementT& tile_offset,
+      gsl::span<FieldElementT> result) const;
+
   void EvalAtPoints(gsl::span<FieldElementT> points, gsl::span<FieldElementT> outputs) const;
 
   int64_t GetDegree() const;
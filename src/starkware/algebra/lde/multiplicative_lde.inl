@@ -13,11 +13,15 @@
 // and limitations under the License.
 
 
+#include <algorithm>
+
+#include "starkware/algebra/fft/fast_polynomials.h"
 #include "starkware/algebra/fft/fft_with_precompute.h"
 #include "starkware/algebra/fft/multiplicative_group_ordering.h"
 #include "starkware/algebra/field_operations.h"
 #include "starkware/algebra/lde/multiplicative_lde.h"
 #include "starkware/algebra/polynomials.h"
+#include "starkware/utils/bit_reversal.h"
 
 namespace starkware {
 
@@ -63,16 +67,55 @@ void MultiplicativeLde<Order, FieldElementT>::EvalAtCoset(
   fft_precompute.Fft(polynomial_, result);
 }
 
+template <MultiplicativeGroupOrdering Order, typename FieldElementT>
+void MultiplicativeLde<Order, FieldElementT>::EvalAtCosetTile(
+    const FftWithPrecompute<BasesT>& fft_precompute, const FieldElementT& tile_offset,
+    gsl::span<FieldElementT> result) const {
+  ASSERT_RELEASE(
+      Order == MultiplicativeGroupOrdering::kBitReversedOrder,
+      "EvalAtCosetTile() requires coefficients in natural order.");
+  const size_t tile_size = result.size();
+  const size_t n_blocks = SafeDiv(polynomial_.size(), tile_size);
+
+  // Reduce the polynomial modulo x^tile_size - shift, using Horner's rule on blocks of tile_size
+  // coefficients.
+  const FieldElementT shift = Pow(tile_offset, tile_size);
+  std::copy(polynomial_.end() - tile_size, polynomial_.end(), result.begin());
+  for (size_t block = n_blocks - 1; block-- > 0;) {
+    const FieldElementT* coefficients = &polynomial_[block * tile_size];
+    for (size_t i = 0; i < tile_size; ++i) {
+      result[i] = result[i] * shift + coefficients[i];
+    }
+  }
+
+  fft_precompute.Fft(result, result);
+}
+
 template <MultiplicativeGroupOrdering Order, typename FieldElementT>
 void MultiplicativeLde<Order, FieldElementT>::EvalAtPoints(
     gsl::span<FieldElementT> points, gsl::span<FieldElementT> outputs) const {
+  // Polynomials given by their coefficients (e.g., the last FRI layer) are often zero padded to the
+  // size of the domain. Skip the zero high coefficients.
+  const size_t n_coefs = std::max<int64_t>(GetDegree() + 1, 1);
   switch (Order) {
     case MultiplicativeGroupOrdering::kBitReversedOrder:
-      OptimizedBatchHornerEval<FieldElementT>(points, polynomial_, outputs);
+      MultipointEval<FieldElementT>(points, gsl::make_span(polynomial_).first(n_coefs), outputs);
       break;
     case MultiplicativeGroupOrdering::kNaturalOrder:
       // Natural Order Lde stores polynomial_ in BitReversed order.
-      BatchHornerEvalBitReversed<FieldElementT>(points, polynomial_, outputs);
+      if (n_coefs < polynomial_.size()) {
+        const size_t log_n = SafeLog2(polynomial_.size());
+        std::vector<FieldElementT> coefs;
+        coefs.reserve(n_coefs);
+        for (size_t i = 0; i < n_coefs; ++i) {
+          coefs.push_back(polynomial_[BitReverse(i, log_n)]);
+        }
+        MultipointEval<FieldElementT>(points, coefs, outputs);
+      } else if (ShouldUseFastMultipointEval<FieldElementT>(polynomial_.size(), points.size())) {
+        FastMultipointEval<FieldElementT>(points, BitReverseVector(polynomial_), outputs);
+      } else {
+        BatchHornerEvalBitReversed<FieldElementT>(points, polynomial_, outputs);
+      }
       break;
   }
 }
@@ -15,6 +15,7 @@
 #ifndef STARKWARE_ALGEBRA_POLYNOMIALS_H_
 #define STARKWARE_ALGEBRA_POLYNOMIALS_H_
 
+#include <utility>
 #include <vector>
 
 #include "third_party/gsl/gsl-lite.hpp"
@@ -28,7 +29,8 @@ namespace starkware {
   Returns the interpolant polynomial p(x) of degree less than domain.size(), such that for every 'i'
   it holds that p(domain[i]) = values[i].
   Implemented using naive Lagrange interpolation. This function is not efficient, its
-  complexity is O(n^3). Use only for testing or small inputs.
+  complexity is O(n^3). Use only for testing or small inputs (see FastInterpolation() in
+  starkware/algebra/fft/fast_polynomials.h).
 */
 template <typename FieldElementT>
 std::vector<FieldElementT> LagrangeInterpolation(
@@ -110,6 +112,35 @@ void BatchHornerEvalBitReversed(
     gsl::span<const FieldElementT> points, gsl::span<const FieldElementT> coefs,
     gsl::span<FieldElementT> outputs);
 
+/*
+  Evaluates several polynomials, each at some of the given points. For every i:
+    outputs[i] = polynomials[queries[i].first](points[queries[i].second]).
+  All the polynomials must have the same number of coefficients.
+
+  Equivalent to calling ParallelBatchHornerEval() separately for every polynomial, but the
+  coefficients are split into chunks of at least min_chunk_size coefficients, which are processed in
+  parallel. Each task evaluates all the queries on its chunk (so that every coefficient is read from
+  memory exactly once, while it is still in the cache) and the partial results are summed at the
+  end. The powers points[j]^(chunk start) are computed once per chunk for all the polynomials.
+*/
+template <typename FieldElementT>
+void MultiPolynomialBatchHornerEval(
+    gsl::span<const FieldElementT> points,
+    gsl::span<const gsl::span<const FieldElementT>> polynomials,
+    gsl::span<const std::pair<size_t, size_t>> queries, gsl::span<FieldElementT> outputs,
+    size_t min_chunk_size = Pow2(13));
+
+/*
+  Same as MultiPolynomialBatchHornerEval(), except that the coefficients of every polynomial are
+  given in bit reversed order (and particularly their number is a power of two).
+*/
+template <typename FieldElementT>
+void MultiPolynomialBatchHornerEvalBitReversed(
+    gsl::span<const FieldElementT> points,
+    gsl::span<const gsl::span<const FieldElementT>> polynomials,
+    gsl::span<const std::pair<size_t, size_t>> queries, gsl::span<FieldElementT> outputs,
+    size_t min_chunk_size = Pow2(13));
+
 }  // namespace starkware
 
 #include "starkware/algebra/polynomials.inl"
@@ -16,6 +16,7 @@
 #include "starkware/utils/bit_reversal.h"
 #include "starkware/utils/task_manager.h"
 
+#include <algorithm>
 #include <mutex>
 #include <unordered_map>
 
@@ -275,4 +276,140 @@ void BatchHornerEvalBitReversed(
   }
 }
 
+namespace polynomials {
+namespace details {
+
+/*
+  Implements MultiPolynomialBatchHornerEval() and MultiPolynomialBatchHornerEvalBitReversed().
+
+  The coefficients are split into n_chunks = 2^k chunks. In natural order, chunk j holds the
+  coefficients of x^(j * chunk_size), ..., x^((j + 1) * chunk_size - 1), so its contribution to f(x)
+  is x^(j * chunk_size) * q_j(x) where q_j is the polynomial defined by the chunk.
+  In bit reversed order, chunk j holds (in bit reversed order) the coefficients of
+  x^r, x^(r + n_chunks), x^(r + 2 * n_chunks), ..., where r = BitReverse(j, k), so its contribution
+  to f(x) is x^r * q_j(x^n_chunks).
+*/
+template <typename FieldElementT>
+void MultiPolynomialBatchHornerEvalImpl(
+    gsl::span<const FieldElementT> points,
+    gsl::span<const gsl::span<const FieldElementT>> polynomials,
+    gsl::span<const std::pair<size_t, size_t>> queries, gsl::span<FieldElementT> outputs,
+    size_t min_chunk_size, bool bit_reversed) {
+  ASSERT_RELEASE(
+      outputs.size() == queries.size(),
+      "The number of outputs must be the same as the number of queries.");
+  for (FieldElementT& res : outputs) {
+    res = FieldElementT::Zero();
+  }
+  if (queries.empty()) {
+    return;
+  }
+
+  // Group the queries by polynomial.
+  std::vector<std::vector<size_t>> queries_per_polynomial(polynomials.size());
+  for (size_t query_idx = 0; query_idx < queries.size(); ++query_idx) {
+    const auto& [polynomial_idx, point_idx] = queries[query_idx];
+    ASSERT_RELEASE(polynomial_idx < polynomials.size(), "Polynomial index out of range.");
+    ASSERT_RELEASE(point_idx < points.size(), "Point index out of range.");
+    queries_per_polynomial[polynomial_idx].push_back(query_idx);
+  }
+
+  const size_t n_coefs = polynomials[0].size();
+  for (const auto& polynomial : polynomials) {
+    ASSERT_RELEASE(
+        polynomial.size() == n_coefs,
+        "All the polynomials must have the same number of coefficients.");
+  }
+  if (n_coefs == 0) {
+    return;
+  }
+  if (bit_reversed) {
+    ASSERT_RELEASE(IsPowerOfTwo(n_coefs), "The number of coefficients must be a power of two.");
+  }
+
+  size_t log_n_chunks = 0;
+  while ((n_coefs >> (log_n_chunks + 1)) >= std::max<size_t>(min_chunk_size, 1)) {
+    log_n_chunks++;
+  }
+  const size_t n_chunks = Pow2(log_n_chunks);
+  const size_t chunk_size = DivCeil(n_coefs, n_chunks);
+
+  // The points at which the polynomials defined by the chunks are evaluated.
+  std::vector<FieldElementT> chunk_points;
+  chunk_points.reserve(points.size());
+  for (const FieldElementT& point : points) {
+    chunk_points.push_back(bit_reversed ? Pow(point, n_chunks) : point);
+  }
+
+  std::mutex output_lock;
+  TaskManager::GetInstance().ParallelFor(
+      n_chunks,
+      [&](const TaskInfo& task_info) {
+        const size_t chunk_idx = task_info.start_idx;
+        const size_t chunk_start = std::min(chunk_idx * chunk_size, n_coefs);
+        const size_t chunk_end = std::min(chunk_start + chunk_size, n_coefs);
+        const uint64_t shift = bit_reversed ? BitReverse(chunk_idx, log_n_chunks) : chunk_start;
+
+        std::vector<FieldElementT> shifts;
+        shifts.reserve(points.size());
+        for (const FieldElementT& point : points) {
+          shifts.push_back(Pow(point, shift));
+        }
+
+        std::vector<FieldElementT> partial_outputs(queries.size(), FieldElementT::Zero());
+        std::vector<FieldElementT> polynomial_points;
+        std::vector<FieldElementT> polynomial_outputs;
+        for (size_t polynomial_idx = 0; polynomial_idx < polynomials.size(); ++polynomial_idx) {
+          const std::vector<size_t>& query_indices = queries_per_polynomial[polynomial_idx];
+          if (query_indices.empty()) {
+            continue;
+          }
+          polynomial_points.clear();
+          for (const size_t query_idx : query_indices) {
+            polynomial_points.push_back(chunk_points[queries[query_idx].second]);
+          }
+          polynomial_outputs.assign(query_indices.size(), FieldElementT::Zero());
+          const auto chunk =
+              polynomials[polynomial_idx].subspan(chunk_start, chunk_end - chunk_start);
+          if (bit_reversed) {
+            BatchHornerEvalBitReversed<FieldElementT>(polynomial_points, chunk, polynomial_outputs);
+          } else {
+            BatchHornerEval<FieldElementT>(polynomial_points, chunk, polynomial_outputs);
+          }
+          for (size_t i = 0; i < query_indices.size(); ++i) {
+            partial_outputs[query_indices[i]] =
+                polynomial_outputs[i] * shifts[queries[query_indices[i]].second];
+          }
+        }
+
+        std::unique_lock lock(output_lock);
+        for (size_t output_idx = 0; output_idx < outputs.size(); output_idx++) {
+          outputs[output_idx] += partial_outputs[output_idx];
+        }
+      });
+}
+
+}  // namespace details
+}  // namespace polynomials
+
+template <typename FieldElementT>
+void MultiPolynomialBatchHornerEval(
+    gsl::span<const FieldElementT> points,
+    gsl::span<const gsl::span<const FieldElementT>> polynomials,
+    gsl::span<const std::pair<size_t, size_t>> queries, gsl::span<FieldElementT> outputs,
+    size_t min_chunk_size) {
+  polynomials::details::MultiPolynomialBatchHornerEvalImpl(
+      points, polynomials, queries, outputs, min_chunk_size, /*bit_reversed=*/false);
+}
+
+template <typename FieldElementT>
+void MultiPolynomialBatchHornerEvalBitReversed(
+    gsl::span<const FieldElementT> points,
+    gsl::span<const gsl::span<const FieldElementT>> polynomials,
+    gsl::span<const std::pair<size_t, size_t>> queries, gsl::span<FieldElementT> outputs,
+    size_t min_chunk_size) {
+  polynomials::details::MultiPolynomialBatchHornerEvalImpl(
+      points, polynomials, queries, outputs, min_chunk_size, /*bit_reversed=*/true);
+}
+
 }  // namespace starkware
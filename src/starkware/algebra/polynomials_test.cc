@@ -19,6 +19,7 @@
 
 #include "starkware/algebra/field_operations.h"
 #include "starkware/algebra/fields/test_field_element.h"
+#include "starkware/error_handling/test_utils.h"
 
 namespace starkware {
 namespace {
@@ -171,6 +172,73 @@ TEST(BatchHornerEvalBitReversed, Correctness) {
   }
 }
 
+/*
+  Checks MultiPolynomialBatchHornerEval() (or its bit reversed variant) against HornerEval() on
+  random polynomials, points and queries. A small min_chunk_size is used so that the coefficients
+  are split into several chunks.
+*/
+void TestMultiPolynomialBatchHornerEval(bool bit_reversed, size_t n_coefs, Prng* prng) {
+  const size_t n_polynomials = prng->UniformInt(1, 5);
+  const size_t n_points = prng->UniformInt(1, 6);
+  const size_t n_queries = prng->UniformInt(0, 20);
+
+  std::vector<std::vector<TestFieldElement>> polynomials;
+  std::vector<gsl::span<const TestFieldElement>> polynomial_spans;
+  for (size_t i = 0; i < n_polynomials; ++i) {
+    polynomials.push_back(prng->RandomFieldElementVector<TestFieldElement>(n_coefs));
+  }
+  for (const auto& polynomial : polynomials) {
+    polynomial_spans.emplace_back(polynomial);
+  }
+  const auto points = prng->RandomFieldElementVector<TestFieldElement>(n_points);
+  std::vector<std::pair<size_t, size_t>> queries;
+  for (size_t i = 0; i < n_queries; ++i) {
+    queries.emplace_back(
+        prng->UniformInt<size_t>(0, n_polynomials - 1), prng->UniformInt<size_t>(0, n_points - 1));
+  }
+
+  std::vector<TestFieldElement> results(n_queries, TestFieldElement::Zero());
+  if (bit_reversed) {
+    MultiPolynomialBatchHornerEvalBitReversed<TestFieldElement>(
+        points, polynomial_spans, queries, results, /*min_chunk_size=*/4);
+  } else {
+    MultiPolynomialBatchHornerEval<TestFieldElement>(
+        points, polynomial_spans, queries, results, /*min_chunk_size=*/4);
+  }
+
+  for (size_t i = 0; i < n_queries; ++i) {
+    const auto& [polynomial_idx, point_idx] = queries[i];
+    const auto& polynomial = polynomials[polynomial_idx];
+    ASSERT_EQ(
+        results[i], bit_reversed ? HornerEvalBitReversed(points[point_idx], polynomial)
+                                 : HornerEval(points[point_idx], polynomial));
+  }
+}
+
+TEST(MultiPolynomialBatchHornerEval, Correctness) {
+  Prng prng;
+  TestMultiPolynomialBatchHornerEval(/*bit_reversed=*/false, prng.UniformInt(0, 100), &prng);
+  TestMultiPolynomialBatchHornerEval(/*bit_reversed=*/false, 1, &prng);
+}
+
+TEST(MultiPolynomialBatchHornerEvalBitReversed, Correctness) {
+  Prng prng;
+  TestMultiPolynomialBatchHornerEval(/*bit_reversed=*/true, Pow2(prng.UniformInt(0, 7)), &prng);
+  TestMultiPolynomialBatchHornerEval(/*bit_reversed=*/true, 1, &prng);
+}
+
+TEST(MultiPolynomialBatchHornerEval, DifferentSizes) {
+  const std::vector<TestFieldElement> short_poly(2, TestFieldElement::One());
+  const std::vector<TestFieldElement> long_poly(3, TestFieldElement::One());
+  const std::vector<gsl::span<const TestFieldElement>> polynomials = {short_poly, long_poly};
+  const std::vector<TestFieldElement> points = {TestFieldElement::One()};
+  const std::vector<std::pair<size_t, size_t>> queries = {{0, 0}};
+  std::vector<TestFieldElement> results(1, TestFieldElement::Zero());
+  EXPECT_ASSERT(
+      MultiPolynomialBatchHornerEval<TestFieldElement>(points, polynomials, queries, results),
+      testing::HasSubstr("same number of coefficients"));
+}
+
 template <typename FieldElementT>
 void TestLagrange(const std::vector<FieldElementT> poly, const size_t n_points, Prng* prng) {
   // As the interpolant has number of coefficients as the number of points it was interpolated from,
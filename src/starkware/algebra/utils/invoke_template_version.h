@@ -72,9 +72,12 @@
 
 #include "glog/logging.h"
 
+#include "starkware/algebra/fields/baby_bear_field_element.h"
 #include "starkware/algebra/fields/extension_field_element.h"
+#include "starkware/algebra/fields/goldilocks_field_element.h"
 #include "starkware/algebra/fields/long_field_element.h"
 #include "starkware/algebra/fields/prime_field_element.h"
+#include "starkware/algebra/fields/quartic_extension_field_element.h"
 #include "starkware/algebra/fields/test_field_element.h"
 #include "starkware/algebra/polymorphic/field.h"
 
@@ -126,7 +129,8 @@ using FieldInvokedTypes = InvokedTypes<
     ExtensionFieldElement<LongFieldElement>, ExtensionFieldElement<PrimeFieldElement<252, 0>>,
     ExtensionFieldElement<TestFieldElement>, PrimeFieldElement<124, 5>,
     PrimeFieldElement<254, 1>, PrimeFieldElement<254, 2>, PrimeFieldElement<252, 3>,
-    PrimeFieldElement<255, 4>>;
+    PrimeFieldElement<255, 4>, GoldilocksFieldElement, ExtensionFieldElement<GoldilocksFieldElement>,
+    BabyBearFieldElement, QuarticExtensionFieldElement<BabyBearFieldElement>>;
 
 /*
   Invokes func(field_tag) where field_tag is of type TagType<T> and T is the underlying type of the
@@ -19,9 +19,12 @@
 
 #include "glog/logging.h"
 
+#include "starkware/algebra/fields/baby_bear_field_element.h"
 #include "starkware/algebra/fields/extension_field_element.h"
+#include "starkware/algebra/fields/goldilocks_field_element.h"
 #include "starkware/algebra/fields/long_field_element.h"
 #include "starkware/algebra/fields/prime_field_element.h"
+#include "starkware/algebra/fields/quartic_extension_field_element.h"
 #include "starkware/algebra/fields/test_field_element.h"
 #include "starkware/algebra/polymorphic/field.h"
 
@@ -61,6 +64,18 @@ std::optional<Field> NameToField(const std::string& field_name) {
   if (field_name == "ExtensionPrimeField0") {
     return Field::Create<ExtensionFieldElement<PrimeFieldElement<252, 0>>>();
   }
+  if (field_name == "GoldilocksField") {
+    return Field::Create<GoldilocksFieldElement>();
+  }
+  if (field_name == "ExtensionGoldilocksField") {
+    return Field::Create<ExtensionFieldElement<GoldilocksFieldElement>>();
+  }
+  if (field_name == "BabyBearField") {
+    return Field::Create<BabyBearFieldElement>();
+  }
+  if (field_name == "QuarticExtensionBabyBearField") {
+    return Field::Create<QuarticExtensionFieldElement<BabyBearFieldElement>>();
+  }
 
   LOG(ERROR) << "Invalid field name: " << field_name;
   return std::nullopt;
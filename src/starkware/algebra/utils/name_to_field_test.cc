@@ -16,9 +16,12 @@
 
 #include "gtest/gtest.h"
 
+#include "starkware/algebra/fields/baby_bear_field_element.h"
 #include "starkware/algebra/fields/extension_field_element.h"
+#include "starkware/algebra/fields/goldilocks_field_element.h"
 #include "starkware/algebra/fields/long_field_element.h"
 #include "starkware/algebra/fields/prime_field_element.h"
+#include "starkware/algebra/fields/quartic_extension_field_element.h"
 #include "starkware/algebra/fields/test_field_element.h"
 
 namespace starkware {
@@ -35,6 +38,10 @@ TEST(NameToField, BasicTest) {
   EXPECT_TRUE(NameToField("ExtensionTestField"));
   EXPECT_TRUE(NameToField("ExtensionLongField"));
   EXPECT_TRUE(NameToField("ExtensionPrimeField0"));
+  EXPECT_TRUE(NameToField("GoldilocksField"));
+  EXPECT_TRUE(NameToField("ExtensionGoldilocksField"));
+  EXPECT_TRUE(NameToField("BabyBearField"));
+  EXPECT_TRUE(NameToField("QuarticExtensionBabyBearField"));
 
   EXPECT_FALSE(NameToField("BloomField"));
 
@@ -54,6 +61,14 @@ TEST(NameToField, BasicTest) {
   EXPECT_EQ(
       (Field::Create<ExtensionFieldElement<PrimeFieldElement<252, 0>>>()),
       NameToField("ExtensionPrimeField0"));
+  EXPECT_EQ(Field::Create<GoldilocksFieldElement>(), NameToField("GoldilocksField"));
+  EXPECT_EQ(
+      (Field::Create<ExtensionFieldElement<GoldilocksFieldElement>>()),
+      NameToField("ExtensionGoldilocksField"));
+  EXPECT_EQ(Field::Create<BabyBearFieldElement>(), NameToField("BabyBearField"));
+  EXPECT_EQ(
+      (Field::Create<QuarticExtensionFieldElement<BabyBearFieldElement>>()),
+      NameToField("QuarticExtensionBabyBearField"));
 }
 
 }  // namespace
@@ -26,6 +26,7 @@
 #include "starkware/algebra/fields/test_field_element.h"
 #include "starkware/algebra/polymorphic/field.h"
 #include "starkware/crypt_tools/blake2s.h"
+#include "starkware/crypt_tools/poseidon.h"
 #include "starkware/error_handling/test_utils.h"
 #include "starkware/stl_utils/containers.h"
 
@@ -247,6 +248,44 @@ TYPED_TEST(NoninteractiveChannelTest, SendReceiveConsistency) {
       verifier_channel.template ReceiveCommitmentHash<Blake2s256>(), HasSubstr("Proof too short."));
 }
 
+/*
+  A prover/verifier round trip with Poseidon3 as the channel hash, as selected by
+  channel_hash = "poseidon3" in the prover parameters. This covers HashChain<Poseidon3> and the
+  proof of work with Poseidon3.
+*/
+TEST(NoninteractiveChannel, Poseidon3ChannelHash) {
+  const Field prime_field = Field::Create<PrimeFieldElement<252, 0>>();
+  Prng prng(MakeByteArray<0xca, 0xfe, 0xca, 0xfe>());
+  const PrngImpl<Poseidon3> channel_prng(MakeByteArray<0x0, 0x0, 0x0, 0x0>());
+  ASSERT_EQ(channel_prng.GetHashName(), "poseidon3");
+
+  NoninteractiveProverChannel prover_channel(channel_prng.Clone());
+  const std::vector<std::byte> pdata = prng.RandomByteVector(41);
+  prover_channel.SendBytes(pdata);
+  const FieldElement pelem = prime_field.RandomElement(&prng);
+  prover_channel.SendFieldElement(pelem);
+  const FieldElement prandom_elem = prover_channel.ReceiveFieldElement(prime_field);
+  const size_t work_bits = 8;
+  prover_channel.ApplyProofOfWork(work_bits);
+  const uint64_t pnumber = prover_channel.ReceiveNumber(1000);
+  const std::vector<std::byte> proof = prover_channel.GetProof();
+
+  NoninteractiveVerifierChannel verifier_channel(channel_prng.Clone(), proof);
+  EXPECT_EQ(verifier_channel.ReceiveBytes(pdata.size()), pdata);
+  EXPECT_EQ(verifier_channel.ReceiveFieldElement(prime_field), pelem);
+  EXPECT_EQ(verifier_channel.GetAndSendRandomFieldElement(prime_field), prandom_elem);
+  verifier_channel.ApplyProofOfWork(work_bits);
+  EXPECT_EQ(verifier_channel.GetAndSendRandomNumber(1000), pnumber);
+  EXPECT_TRUE(verifier_channel.IsEndOfProof());
+
+  // The proof does not verify with a different channel hash.
+  NoninteractiveVerifierChannel keccak_verifier_channel(
+      Prng(MakeByteArray<0x0, 0x0, 0x0, 0x0>()).Clone(), proof);
+  keccak_verifier_channel.ReceiveBytes(pdata.size());
+  keccak_verifier_channel.ReceiveFieldElement(prime_field);
+  EXPECT_NE(keccak_verifier_channel.GetAndSendRandomFieldElement(prime_field), prandom_elem);
+}
+
 /*
   This test mimics the expected behavior of a FRI prover while using the channel.
   This is done without integration with the FRI implementation, as a complement to the FRI test
@@ -13,10 +13,12 @@
 // and limitations under the License.
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 
 #include "third_party/cppitertools/range.hpp"
 
+#include "starkware/crypt_tools/batch_hash.h"
 #include "starkware/utils/profiling.h"
 #include "starkware/utils/serialization.h"
 
@@ -37,6 +39,21 @@ HashT InitHash(gsl::span<const std::byte> seed, size_t work_bits) {
   return HashT::HashBytesWithLength(init_bytes);
 }
 
+/*
+  Number of nonces hashed together by the prover, when HashT has a multi-buffer implementation (see
+  kHasBatchHash).
+*/
+constexpr size_t kNoncesPerBatch = 8;
+
+/*
+  Returns the 64 most significant bits of the digest of hash.
+*/
+template <typename HashT>
+uint64_t DigestWord(const HashT& hash) {
+  return Deserialize<uint64_t>(
+      gsl::make_span(hash.GetDigest()).first(sizeof(uint64_t)), /*use_big_endian=*/true);
+}
+
 }  // namespace details
 }  // namespace proof_of_work
 
@@ -50,15 +67,44 @@ template <typename HashT>
 std::optional<std::uint64_t> SearchChunk(
     uint64_t nonce_start, uint64_t chunk_size, gsl::span<std::byte> thread_bytes,
     uint64_t work_limit) {
+  using proof_of_work::details::DigestWord;
+  const uint64_t nonce_end = nonce_start + chunk_size;
+  uint64_t nonce = nonce_start;
+
+  if constexpr (kHasBatchHash<HashT>) {
+    // Hash kNoncesPerBatch nonces together, using the multi-buffer implementation of HashT. The
+    // messages differ only in their nonces, so the prefixes are copied once.
+    constexpr size_t kBatchSize = proof_of_work::details::kNoncesPerBatch;
+    constexpr size_t kMessageSize = HashT::kDigestNumBytes + sizeof(uint64_t);
+    ASSERT_RELEASE(thread_bytes.size() == kMessageSize, "Wrong message size.");
+    std::array<std::byte, kBatchSize * kMessageSize> messages{};
+    for (size_t i = 0; i < kBatchSize; ++i) {
+      std::copy(thread_bytes.begin(), thread_bytes.end(), messages.begin() + i * kMessageSize);
+    }
+    std::array<HashT, kBatchSize> hashes;
+    for (; nonce + kBatchSize <= nonce_end; nonce += kBatchSize) {
+      for (size_t i = 0; i < kBatchSize; ++i) {
+        Serialize<uint64_t>(
+            nonce + i,
+            gsl::make_span(messages).subspan(
+                i * kMessageSize + HashT::kDigestNumBytes, sizeof(uint64_t)),
+            /*use_big_endian=*/true);
+      }
+      HashBytesWithLengthBatch<HashT>(messages, kMessageSize, hashes);
+      // Check the nonces in order, so that the first valid nonce of the chunk is returned.
+      for (size_t i = 0; i < kBatchSize; ++i) {
+        if (DigestWord(hashes[i]) < work_limit) {
+          return nonce + i;
+        }
+      }
+    }
+  }
+
   gsl::span<std::byte> nonce_span = thread_bytes.last(sizeof(uint64_t));
-  for (uint64_t nonce = nonce_start; nonce < nonce_start + chunk_size; ++nonce) {
+  for (; nonce < nonce_end; ++nonce) {
     Serialize<uint64_t>(nonce, nonce_span, /*use_big_endian=*/true);
-    const HashT hash = HashT::HashBytesWithLength(thread_bytes);
-    const uint64_t digest_word = Deserialize<uint64_t>(
-        gsl::make_span(hash.GetDigest()).first(sizeof(uint64_t)),
-        /*use_big_endian=*/true);
     // Test we have enough zero bits.
-    if (digest_word < work_limit) {
+    if (DigestWord(HashT::HashBytesWithLength(thread_bytes)) < work_limit) {
       return nonce;
     }
   }
@@ -76,7 +122,9 @@ std::vector<std::byte> ProofOfWorkProver<HashT>::Prove(
 
   const HashT init_hash = proof_of_work::details::InitHash<HashT>(seed, work_bits);
   std::array<std::byte, HashT::kDigestNumBytes + sizeof(uint64_t)> bytes{};
-  std::copy(init_hash.GetDigest().begin(), init_hash.GetDigest().end(), bytes.begin());
+  // GetDigest() may return a temporary (e.g., for Poseidon3), so it is called once.
+  const auto& init_digest = init_hash.GetDigest();
+  std::copy(init_digest.begin(), init_digest.end(), bytes.begin());
 
   const uint64_t work_limit = Pow2(64 - work_bits);
   const uint64_t chunk_size = Pow2(log_chunk_size);
@@ -127,15 +175,12 @@ bool ProofOfWorkVerifier<HashT>::Verify(
 
   const HashT init_hash = proof_of_work::details::InitHash<HashT>(seed, work_bits);
   std::array<std::byte, HashT::kDigestNumBytes + sizeof(uint64_t)> bytes{};
-  std::copy(init_hash.GetDigest().begin(), init_hash.GetDigest().end(), bytes.begin());
+  const auto& init_digest = init_hash.GetDigest();
+  std::copy(init_digest.begin(), init_digest.end(), bytes.begin());
   std::copy(nonce_bytes.begin(), nonce_bytes.end(), bytes.begin() + HashT::kDigestNumBytes);
   const uint64_t work_limit = Pow2(64 - work_bits);
 
-  const HashT hash = HashT::HashBytesWithLength(bytes);
-  const uint64_t digest_word = Deserialize<uint64_t>(
-      gsl::make_span(hash.GetDigest()).first(sizeof(uint64_t)), /*use_big_endian=*/true);
-
-  return digest_word < work_limit;
+  return proof_of_work::details::DigestWord(HashT::HashBytesWithLength(bytes)) < work_limit;
 }
 
 }  // namespace starkware
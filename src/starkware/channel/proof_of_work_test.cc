@@ -18,7 +18,11 @@
 
 #include "starkware/channel/noninteractive_prover_channel.h"
 #include "starkware/channel/noninteractive_verifier_channel.h"
+#include "starkware/crypt_tools/blake2s.h"
 #include "starkware/crypt_tools/keccak_256.h"
+#include "starkware/crypt_tools/poseidon.h"
+#include "starkware/stl_utils/containers.h"
+#include "starkware/utils/serialization.h"
 
 namespace starkware {
 namespace {
@@ -64,6 +68,48 @@ TEST(ProofOfWork, BitChange) {
   }
 }
 
+/*
+  Checks that the prover returns the smallest valid nonce, for chunk sizes which are smaller than,
+  equal to, and not a multiple of the number of nonces hashed together.
+*/
+template <typename HashT>
+void TestLowestNonce() {
+  Prng prng;
+  const size_t work_bits = 10;
+  ProofOfWorkVerifier<HashT> pow_verifier;
+  std::vector<std::byte> expected_witness(sizeof(uint64_t));
+  for (uint64_t nonce = 0;; ++nonce) {
+    Serialize<uint64_t>(nonce, expected_witness, /*use_big_endian=*/true);
+    if (pow_verifier.Verify(prng.GetPrngState(), work_bits, expected_witness)) {
+      break;
+    }
+  }
+
+  ProofOfWorkProver<HashT> pow_prover;
+  for (uint64_t log_chunk_size : {0, 2, 3, 5, 20}) {
+    EXPECT_EQ(pow_prover.Prove(prng.GetPrngState(), work_bits, log_chunk_size), expected_witness);
+  }
+}
+
+TEST(ProofOfWork, LowestNonceKeccak) { TestLowestNonce<Keccak256>(); }
+
+TEST(ProofOfWork, LowestNonceBlake) { TestLowestNonce<Blake2s256>(); }
+
+TEST(ProofOfWork, LowestNoncePoseidon3) { TestLowestNonce<Poseidon3>(); }
+
+TEST(ProofOfWork, CompletenessAndSoundnessPoseidon3) {
+  Prng prng(MakeByteArray<0xca, 0xfe, 0xca, 0xfe>());
+  ProofOfWorkProver<Poseidon3> pow_prover;
+
+  const size_t work_bits = 10;
+  auto witness = pow_prover.Prove(prng.GetPrngState(), work_bits);
+
+  ProofOfWorkVerifier<Poseidon3> pow_verifier;
+  EXPECT_TRUE(pow_verifier.Verify(prng.GetPrngState(), work_bits, witness));
+  witness.back() ^= std::byte(1);
+  EXPECT_FALSE(pow_verifier.Verify(prng.GetPrngState(), work_bits, witness));
+}
+
 #ifndef __EMSCRIPTEN__
 TEST(ProofOfWork, ParallelCompleteness) {
   Prng prng;
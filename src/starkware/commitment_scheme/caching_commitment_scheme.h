@@ -24,6 +24,7 @@
 
 #include "starkware/commitment_scheme/commitment_scheme.h"
 #include "starkware/math/math.h"
+#include "starkware/utils/scratch_vector.h"
 
 namespace starkware {
 
@@ -71,9 +72,9 @@ class CachingCommitmentSchemeProver : public CommitmentSchemeProver {
   std::unique_ptr<CommitmentSchemeProver> inner_commitment_scheme_;
 
   /*
-    Stores the elements of the current layer.
+    Stores the elements of the current layer. May be backed by a scratch file (see ScratchVector).
   */
-  std::vector<std::byte> layer_data_;
+  ScratchVector<std::byte> layer_data_;
 
   /*
     Indices of elements needed for the next commitment scheme to compute the required queries.
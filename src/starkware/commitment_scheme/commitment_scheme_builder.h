@@ -31,17 +31,21 @@ namespace starkware {
 /*
   Creates a chain of commitment scheme layers that handle the commitment. Returns the outermost
   layer (which is a packaging commitment scheme prover layer).
+  If merkle_cap_height > 0, the commitment is the 2^merkle_cap_height nodes at that depth of the
+  tree instead of its root, and the authentication paths stop there (the height is truncated to the
+  height of the tree). The verifier must be created with the same merkle_cap_height.
 */
 template <typename HashT>
 PackagingCommitmentSchemeProver<HashT> MakeCommitmentSchemeProver(
     size_t size_of_element, size_t n_elements_in_segment, size_t n_segments, ProverChannel* channel,
     size_t n_verifier_friendly_commitment_layers, const CommitmentHashes& commitment_hashes,
-    size_t n_out_of_memory_merkle_layers = 0);
+    size_t n_out_of_memory_merkle_layers = 0, size_t merkle_cap_height = 0);
 
 template <typename HashT>
 PackagingCommitmentSchemeVerifier<HashT> MakeCommitmentSchemeVerifier(
     size_t size_of_element, uint64_t n_elements, VerifierChannel* channel,
-    size_t n_verifier_friendly_commitment_layers, const CommitmentHashes& commitment_hashes);
+    size_t n_verifier_friendly_commitment_layers, const CommitmentHashes& commitment_hashes,
+    size_t merkle_cap_height = 0);
 
 }  // namespace starkware
 
@@ -63,24 +63,34 @@ inline size_t CalculateNVerifierFriendlyLayersInSegment(
   Note: the commitment is done in a way that the data is split into segments and we commit to each
   segment separately. The smallest layer contains only one element in each segment. All these single
   elements form the leaves of a Merkle tree.
+  If the Merkle cap is deeper than the tree of the segments, the smallest layer contains
+  2^merkle_cap_height / n_segments elements in each segment instead, and the leaves of the Merkle
+  tree are its cap.
 */
 inline std::unique_ptr<CommitmentSchemeProver> CreateAllCommitmentSchemeLayers(
     size_t n_out_of_memory_merkle_layers, size_t n_elements_in_segment, size_t n_segments,
     ProverChannel* channel, size_t n_verifier_friendly_commitment_layers,
-    const CommitmentHashes& commitment_hashes) {
+    const CommitmentHashes& commitment_hashes, size_t merkle_cap_height = 0) {
+  const size_t n_layers_in_segment = SafeLog2(n_elements_in_segment);
+  const size_t segment_tree_height = SafeLog2(n_segments);
+  merkle_cap_height = std::min(merkle_cap_height, segment_tree_height + n_layers_in_segment);
+  // The number of layers of each segment that are replaced by the cap.
+  const size_t n_cap_layers_in_segment =
+      merkle_cap_height > segment_tree_height ? merkle_cap_height - segment_tree_height : 0;
+
   // Creates the innermost layer which holds the Merkle Tree.
   // If it is bigger then 0 the innermost layer definitely uses the top hash (the entire segment
   // tree uses a single hash).
   const bool is_top_hash_layer = n_verifier_friendly_commitment_layers > 0;
-  std::unique_ptr<CommitmentSchemeProver> next_inner_layer =
-      commitment_hashes.Invoke(is_top_hash_layer, [n_segments, channel](auto hash_tag) {
+  std::unique_ptr<CommitmentSchemeProver> next_inner_layer = commitment_hashes.Invoke(
+      is_top_hash_layer,
+      [n_segments, n_cap_layers_in_segment, merkle_cap_height, channel](auto hash_tag) {
         using hash_t = typename decltype(hash_tag)::type;
-        auto commitment_scheme =
-            std::make_unique<MerkleCommitmentSchemeProver<hash_t>>(n_segments, channel);
+        auto commitment_scheme = std::make_unique<MerkleCommitmentSchemeProver<hash_t>>(
+            n_segments * Pow2(n_cap_layers_in_segment), n_segments, merkle_cap_height, channel);
         return std::unique_ptr<CommitmentSchemeProver>(std::move(commitment_scheme));
       });
 
-  const size_t n_layers_in_segment = SafeLog2(n_elements_in_segment);
   const size_t n_in_memory_layers =
       n_layers_in_segment - std::min(n_out_of_memory_merkle_layers, n_layers_in_segment);
 
@@ -95,8 +105,8 @@ inline std::unique_ptr<CommitmentSchemeProver> CreateAllCommitmentSchemeLayers(
   // Iterate over the layers from inner to outer. First creates in-memory layers, then out of
   // memory layers. (There are 2 elements in each segment in the innermost layer which is not the
   // Merkle tree layer (that was already created above)).
-  size_t cur_n_elements_in_segment = 1;
-  for (size_t layer = 0; layer < n_layers_in_segment; ++layer) {
+  size_t cur_n_elements_in_segment = Pow2(n_cap_layers_in_segment);
+  for (size_t layer = n_cap_layers_in_segment; layer < n_layers_in_segment; ++layer) {
     cur_n_elements_in_segment *= 2;
     ASSERT_RELEASE(
         cur_n_elements_in_segment <= n_elements_in_segment,
@@ -132,24 +142,25 @@ inline std::unique_ptr<CommitmentSchemeProver> CreateAllCommitmentSchemeLayers(
 */
 inline std::unique_ptr<CommitmentSchemeVerifier> CreateCommitmentSchemeVerifierLayers(
     size_t n_elements, VerifierChannel* channel, size_t n_verifier_friendly_commitment_layers,
-    const CommitmentHashes& commitment_hashes) {
+    const CommitmentHashes& commitment_hashes, size_t merkle_cap_height = 0) {
   const size_t n_layers = SafeLog2(n_elements);
   const size_t n_verifier_friendly_layers =
       std::min(n_layers, n_verifier_friendly_commitment_layers);
+  merkle_cap_height = std::min(merkle_cap_height, n_layers);
 
-  // The most inner layer.
-  size_t cur_n_elements_in_layer = 1;
+  // The most inner layer, which holds the cap.
+  size_t cur_n_elements_in_layer = Pow2(merkle_cap_height);
   bool is_top_hash = n_verifier_friendly_layers > 0;
-  std::unique_ptr<CommitmentSchemeVerifier> next_inner_layer =
-      commitment_hashes.Invoke(is_top_hash, [cur_n_elements_in_layer, channel](auto hash_tag) {
+  std::unique_ptr<CommitmentSchemeVerifier> next_inner_layer = commitment_hashes.Invoke(
+      is_top_hash, [cur_n_elements_in_layer, merkle_cap_height, channel](auto hash_tag) {
         using hash_t = typename decltype(hash_tag)::type;
         auto commitment_scheme = std::make_unique<MerkleCommitmentSchemeVerifier<hash_t>>(
-            cur_n_elements_in_layer, channel);
+            cur_n_elements_in_layer, merkle_cap_height, channel);
         return std::unique_ptr<CommitmentSchemeVerifier>(std::move(commitment_scheme));
       });
 
   // Create the rest of the layers, from inner to outer.
-  for (size_t layer = 0; layer < n_layers; ++layer) {
+  for (size_t layer = merkle_cap_height; layer < n_layers; ++layer) {
     cur_n_elements_in_layer *= 2;
     ASSERT_RELEASE(
         cur_n_elements_in_layer <= n_elements,
@@ -178,17 +189,17 @@ template <typename HashT>
 PackagingCommitmentSchemeProver<HashT> MakeCommitmentSchemeProver(
     size_t size_of_element, size_t n_elements_in_segment, size_t n_segments, ProverChannel* channel,
     size_t n_verifier_friendly_commitment_layers, const CommitmentHashes& commitment_hashes,
-    size_t n_out_of_memory_merkle_layers) {
+    size_t n_out_of_memory_merkle_layers, size_t merkle_cap_height) {
   // Create a chain of in-memory layers and then out-of-memory layers. The smallest most inner
   // layer is a Merkle commitment scheme which holds a Merkle tree. For the outermost layer
   // is_merkle_layer == false, and it is not one of the out-of-memory Merkle layers.
   PackagingCommitmentSchemeProver<HashT> outer_layer(
       size_of_element, n_elements_in_segment, n_segments, channel,
       [n_out_of_memory_merkle_layers, n_segments, channel, n_verifier_friendly_commitment_layers,
-       commitment_hashes](size_t n_elements_inner_layer) {
+       commitment_hashes, merkle_cap_height](size_t n_elements_inner_layer) {
         return commitment_scheme_builder::details::CreateAllCommitmentSchemeLayers(
             n_out_of_memory_merkle_layers, SafeDiv(n_elements_inner_layer, n_segments), n_segments,
-            channel, n_verifier_friendly_commitment_layers, commitment_hashes);
+            channel, n_verifier_friendly_commitment_layers, commitment_hashes, merkle_cap_height);
       });
 
   return outer_layer;
@@ -197,16 +208,17 @@ PackagingCommitmentSchemeProver<HashT> MakeCommitmentSchemeProver(
 template <typename HashT>
 PackagingCommitmentSchemeVerifier<HashT> MakeCommitmentSchemeVerifier(
     size_t size_of_element, uint64_t n_elements, VerifierChannel* channel,
-    size_t n_verifier_friendly_commitment_layers, const CommitmentHashes& commitment_hashes) {
+    size_t n_verifier_friendly_commitment_layers, const CommitmentHashes& commitment_hashes,
+    size_t merkle_cap_height) {
   // Create a chain of commitment scheme layers. The smallest most inner is a Merkle commitment
   // scheme which holds a Merkle tree. For the outermost layer is_merkle_layer == false.
   return PackagingCommitmentSchemeVerifier<HashT>(
       size_of_element, n_elements, channel,
-      [channel, n_verifier_friendly_commitment_layers,
-       commitment_hashes](size_t n_elements_inner_layer) {
+      [channel, n_verifier_friendly_commitment_layers, commitment_hashes,
+       merkle_cap_height](size_t n_elements_inner_layer) {
         return commitment_scheme_builder::details::CreateCommitmentSchemeVerifierLayers(
             n_elements_inner_layer, channel, n_verifier_friendly_commitment_layers,
-            commitment_hashes);
+            commitment_hashes, merkle_cap_height);
       },
       false);
 }
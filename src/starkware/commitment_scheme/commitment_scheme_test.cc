@@ -32,6 +32,7 @@
 #include "starkware/crypt_tools/keccak_256.h"
 #include "starkware/crypt_tools/masked_hash.h"
 #include "starkware/crypt_tools/pedersen.h"
+#include "starkware/crypt_tools/poseidon.h"
 #include "starkware/error_handling/error_handling.h"
 #include "starkware/error_handling/test_utils.h"
 #include "starkware/math/math.h"
@@ -175,7 +176,8 @@ using TestTypesTwoHashes = ::testing::Types<
         MaskedHash<Blake2s256, 20, true>, MaskedHash<Keccak256, 20, true>>,
     PackagingCommitmentSchemePairTwoHashesT<
         MaskedHash<Keccak256, 20, false>, MaskedHash<Blake2s256, 20, false>>,
-    PackagingCommitmentSchemePairTwoHashesT<Pedersen, MaskedHash<Blake2s256, 20, false>>>;
+    PackagingCommitmentSchemePairTwoHashesT<Pedersen, MaskedHash<Blake2s256, 20, false>>,
+    PackagingCommitmentSchemePairTwoHashesT<Poseidon3, MaskedHash<Keccak256, 20, false>>>;
 
 /*
   Returns number of segments to use, N, such that:
@@ -554,5 +556,77 @@ TYPED_TEST(CommitmentSchemeSingleHash, LongElement) {
   EXPECT_ASSERT(this->VerifyProof(proof, corrupted_data), HasSubstr("Element size mismatches"));
 }
 
+/*
+  Commits with a random Merkle cap height (possibly deeper than the tree of the segments, or than
+  the entire tree) and checks that the queries are verified against the cap.
+*/
+TEST(CommitmentSchemeMerkleCap, Completeness) {
+  using HashT = Blake2s256;
+  Prng prng;
+  const size_t size_of_element = prng.UniformInt<size_t>(1, 100);
+  const size_t n_elements = Pow2(prng.UniformInt<size_t>(0, 10));
+  const size_t n_segments = DrawNumSegments(
+      size_of_element, n_elements, PackagingCommitmentSchemeProver<HashT>::kMinSegmentBytes, &prng,
+      false);
+  const size_t n_elements_in_segment = SafeDiv(n_elements, n_segments);
+  const size_t merkle_cap_height = prng.UniformInt<size_t>(0, 12);
+  const size_t n_out_of_memory_layers = prng.UniformInt<size_t>(0, 6);
+  const vector<std::byte> data = prng.RandomByteVector(size_of_element * n_elements);
+  set<uint64_t> queries;
+  map<uint64_t, vector<std::byte>> elements_to_verify;
+  for (size_t i = 0; i < 10; ++i) {
+    const uint64_t query = prng.UniformInt<uint64_t>(0, n_elements - 1);
+    queries.insert(query);
+    elements_to_verify[query] = vector<std::byte>(
+        data.begin() + query * size_of_element, data.begin() + (query + 1) * size_of_element);
+  }
+
+  const Prng channel_prng;
+  const auto generate_proof = [&](size_t cap_height) {
+    NoninteractiveProverChannel prover_channel(channel_prng.Clone());
+    auto committer = MakeCommitmentSchemeProver<HashT>(
+        size_of_element, n_elements_in_segment, n_segments, &prover_channel,
+        /*n_verifier_friendly_commitment_layers=*/0, CommitmentHashes(HashT::HashName()),
+        n_out_of_memory_layers, cap_height);
+    const size_t segment_bytes = size_of_element * n_elements_in_segment;
+    for (size_t i = 0; i < n_segments; ++i) {
+      committer.AddSegmentForCommitment(
+          make_span(data).subspan(i * segment_bytes, segment_bytes), i);
+    }
+    committer.Commit();
+    const vector<uint64_t> element_idxs = committer.StartDecommitmentPhase(queries);
+    vector<std::byte> elements_data;
+    for (const uint64_t index : element_idxs) {
+      std::copy_n(
+          data.begin() + index * size_of_element, size_of_element,
+          std::back_inserter(elements_data));
+    }
+    committer.Decommit(elements_data);
+    return prover_channel.GetProof();
+  };
+  const auto verify_proof = [&](const vector<std::byte>& proof,
+                                const map<uint64_t, vector<std::byte>>& elements) {
+    NoninteractiveVerifierChannel verifier_channel(channel_prng.Clone(), proof);
+    auto verifier = MakeCommitmentSchemeVerifier<HashT>(
+        size_of_element, n_elements, &verifier_channel,
+        /*n_verifier_friendly_commitment_layers=*/0, CommitmentHashes(HashT::HashName()),
+        merkle_cap_height);
+    verifier.ReadCommitment();
+    return verifier.VerifyIntegrity(elements);
+  };
+
+  const vector<std::byte> proof = generate_proof(merkle_cap_height);
+  EXPECT_TRUE(verify_proof(proof, elements_to_verify));
+  if (merkle_cap_height == 0) {
+    EXPECT_EQ(proof, generate_proof(0));
+  }
+
+  // Corrupt one of the queried elements.
+  map<uint64_t, vector<std::byte>> corrupted_data = elements_to_verify;
+  auto& element = corrupted_data.begin()->second;
+  element[prng.UniformInt<size_t>(0, element.size() - 1)] ^= std::byte(1);
+  EXPECT_FALSE(verify_proof(proof, corrupted_data));
+}
+
 }  // namespace
 }  // namespace starkware
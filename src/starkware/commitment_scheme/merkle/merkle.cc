@@ -19,12 +19,30 @@
 #include "glog/logging.h"
 
 #include "starkware/commitment_scheme/merkle/merkle.h"
+#include "starkware/crypt_tools/batch_hash.h"
 #include "starkware/crypt_tools/template_instantiation.h"
 #include "starkware/crypt_tools/utils.h"
+#include "starkware/math/math.h"
 #include "starkware/stl_utils/containers.h"
+#include "starkware/utils/task_manager.h"
 
 namespace starkware {
 
+namespace {
+
+/*
+  Subtrees with fewer leaves than this are not worth a task of their own.
+*/
+constexpr size_t kLogMinSubtreeLeaves = 10;
+
+/*
+  The number of subtrees that are computed in parallel is at most 2^kLogMaxNSubtrees. The nodes above
+  them are computed serially, so this also bounds the serial part of the computation.
+*/
+constexpr size_t kLogMaxNSubtrees = 8;
+
+}  // namespace
+
 template <typename HashT>
 void MerkleTree<HashT>::AddData(const gsl::span<const HashT>& data, uint64_t start_index) {
   ASSERT_DEBUG(
@@ -32,39 +50,106 @@ void MerkleTree<HashT>::AddData(const gsl::span<const HashT>& data, uint64_t sta
       "Data of length " + std::to_string(data.size()) + ", starting at " +
           std::to_string(start_index) + " exceeds the data length declared at tree construction, " +
           std::to_string(k_data_length) + ".");
-  // Copy given data to the leaves of the tree.
   VLOG(5) << "Adding data at start_index = " << start_index << ", of size " << data.size();
-  std::copy(data.begin(), data.end(), nodes_.begin() + k_data_length + start_index);
-  // Hash to compute all internal nodes that can be derived solely from the given data.
-  uint64_t cur = (k_data_length + start_index) / 2;
+  const auto nodes = nodes_.AsSpan();
+
+  // Large segments are split into aligned chunks. Each chunk is copied to the leaves of the tree and
+  // its subtree is computed by a separate task.
+  uint64_t chunk_size = 1;
+  if (data.size() >= Pow2(kLogMinSubtreeLeaves + 1)) {
+    chunk_size =
+        Pow2(std::max(kLogMinSubtreeLeaves, Log2Floor(data.size()) - kLogMaxNSubtrees));
+    if (data.size() % chunk_size != 0 || start_index % chunk_size != 0) {
+      chunk_size = 1;
+    }
+  }
+  if (chunk_size == 1) {
+    // Copy given data to the leaves of the tree.
+    std::copy(data.begin(), data.end(), nodes_.begin() + k_data_length + start_index);
+  } else {
+    const size_t log_chunk_size = SafeLog2(chunk_size);
+    TaskManager::GetInstance().ParallelFor(
+        data.size() / chunk_size, [&](const TaskInfo& task_info) {
+          const uint64_t chunk_start = task_info.start_idx * chunk_size;
+          const auto chunk = data.subspan(chunk_start, chunk_size);
+          const uint64_t first_leaf = k_data_length + start_index + chunk_start;
+          std::copy(chunk.begin(), chunk.end(), nodes_.begin() + first_leaf);
+          ComputeSubtree(first_leaf >> log_chunk_size, log_chunk_size);
+        });
+  }
+
+  // Hash to compute all internal nodes that can be derived solely from the given data (or from the
+  // roots of the chunks above).
+  uint64_t cur = (k_data_length + start_index) / chunk_size / 2;
   // Based on the given data, we compute its parent nodes' hashes (referred to here as "sub_layer").
-  for (size_t sub_layer_length = data.size() / 2; sub_layer_length > 0;
+  // The pairs of each sub-layer are independent, so they are hashed together in a batch.
+  for (size_t sub_layer_length = data.size() / chunk_size / 2; sub_layer_length > 0;
        sub_layer_length /= 2, cur /= 2) {
-    for (size_t i = cur; i < cur + sub_layer_length; i++) {
-      // Compute next sub-layer.
-      nodes_[i] = HashT::Hash(nodes_[i * 2], nodes_[i * 2 + 1]);
-      VLOG(6) << "Wrote to inner node #" << i;
-    }
+    // Compute next sub-layer.
+    HashPairsBatch<HashT>(
+        nodes.subspan(cur * 2, sub_layer_length * 2), nodes.subspan(cur, sub_layer_length));
+    VLOG(6) << "Wrote to inner nodes #" << cur << " to #" << cur + sub_layer_length - 1;
   }
 }
 
 template <typename HashT>
 HashT MerkleTree<HashT>::GetRoot(size_t min_depth_assumed_correct) {
-  // Iterating nodes in reverse order to traverse up the tree layer by layer.
-  VLOG(4) << "Computing root, assuming correctness of nodes at depth " << min_depth_assumed_correct;
+  return GetCap(min_depth_assumed_correct, 0)[0];
+}
+
+template <typename HashT>
+std::vector<HashT> MerkleTree<HashT>::GetCap(
+    size_t min_depth_assumed_correct, size_t cap_height) {
+  VLOG(4) << "Computing cap of height " << cap_height << ", assuming correctness of nodes at depth "
+          << min_depth_assumed_correct;
   ASSERT_RELEASE(
       min_depth_assumed_correct < SafeLog2(nodes_.size()),
       "Depth assumed correct must be at most the tree's height.");
-  for (uint64_t i = Pow2(min_depth_assumed_correct) - 1; i > 0; i--) {
-    nodes_[i] = HashT::Hash(nodes_[i * 2], nodes_[i * 2 + 1]);
+  ASSERT_RELEASE(
+      cap_height < SafeLog2(nodes_.size()), "Cap height must be at most the tree's height.");
+  // The number of layers to compute below each cap node.
+  const size_t n_layers =
+      min_depth_assumed_correct > cap_height ? min_depth_assumed_correct - cap_height : 0;
+  size_t top_height = n_layers;
+  if (n_layers > kLogMinSubtreeLeaves) {
+    // Split the tree below the cap into independent subtrees, and compute them in parallel. Then
+    // compute the nodes between them and the cap.
+    top_height = std::min(n_layers - kLogMinSubtreeLeaves, kLogMaxNSubtrees);
+    const size_t subtrees_depth = cap_height + top_height;
+    const size_t subtree_height = min_depth_assumed_correct - subtrees_depth;
+    TaskManager::GetInstance().ParallelFor(
+        Pow2(subtrees_depth), Pow2(subtrees_depth + 1),
+        [&](const TaskInfo& task_info) { ComputeSubtree(task_info.start_idx, subtree_height); });
+  }
+  const uint64_t cap_start = Pow2(cap_height);
+  for (uint64_t cap_node = cap_start; cap_node < 2 * cap_start; ++cap_node) {
+    ComputeSubtree(cap_node, top_height);
+  }
+  return {nodes_.begin() + cap_start, nodes_.begin() + 2 * cap_start};
+}
+
+template <typename HashT>
+void MerkleTree<HashT>::ComputeSubtree(uint64_t subtree_root, size_t n_layers) {
+  const auto nodes = nodes_.AsSpan();
+  // Traverse up the subtree layer by layer. The subtree has 2^layer nodes at depth layer below
+  // subtree_root, starting at node subtree_root * 2^layer.
+  for (size_t layer = n_layers; layer > 0; --layer) {
+    const uint64_t layer_size = Pow2(layer - 1);
+    HashPairsBatch<HashT>(
+        nodes.subspan((subtree_root * layer_size) * 2, layer_size * 2),
+        nodes.subspan(subtree_root * layer_size, layer_size));
   }
-  return nodes_[1];
 }
 
 template <typename HashT>
 void MerkleTree<HashT>::GenerateDecommitment(
-    const std::set<uint64_t>& queries, ProverChannel* channel) const {
+    const std::set<uint64_t>& queries, ProverChannel* channel, size_t cap_height) const {
   ASSERT_RELEASE(!queries.empty(), "Empty input queries.");
+  ASSERT_RELEASE(
+      Pow2(cap_height) <= k_data_length, "Cap height must be at most the tree's height.");
+  // Nodes with index below cap_end are at depth cap_height or less, and are known to the verifier.
+  const uint64_t cap_end = Pow2(cap_height + 1);
+  nodes_.AdviseRandomAccess();
 
   std::queue<uint64_t> queue;
 
@@ -77,8 +162,8 @@ void MerkleTree<HashT>::GenerateDecommitment(
   }
 
   uint64_t node_index = queue.front();
-  // Iterate over the queue until we reach the root node.
-  while (node_index != uint64_t(1)) {
+  // Iterate over the queue until we reach the cap.
+  while (node_index >= cap_end) {
     queue.pop();
 
     // Add the parent node to the queue, before sibling check to avoid empty queue.
@@ -105,8 +190,20 @@ template <typename HashT>
 bool MerkleTree<HashT>::VerifyDecommitment(
     const std::map<uint64_t, HashT>& data_to_verify, uint64_t total_data_length,
     const HashT& merkle_root, VerifierChannel* channel) {
+  return VerifyDecommitment(
+      data_to_verify, total_data_length, gsl::make_span(&merkle_root, 1), channel);
+}
+
+template <typename HashT>
+bool MerkleTree<HashT>::VerifyDecommitment(
+    const std::map<uint64_t, HashT>& data_to_verify, uint64_t total_data_length,
+    gsl::span<const HashT> merkle_cap, VerifierChannel* channel) {
   ASSERT_VERIFIER(
       total_data_length > 0, "Data length has to be at least 1 (i.e. tree cannot be empty).");
+  ASSERT_VERIFIER(
+      IsPowerOfTwo(merkle_cap.size()) && merkle_cap.size() <= total_data_length,
+      "Invalid Merkle cap size.");
+  const uint64_t cap_start = merkle_cap.size();
 
   std::queue<std::pair<uint64_t, HashT>> queue;
   // Fix offset of query enumeration.
@@ -122,7 +219,7 @@ bool MerkleTree<HashT>::VerifyDecommitment(
   uint64_t node_index;
   HashT node_hash;
   std::tie(node_index, node_hash) = queue.front();
-  while (node_index != uint64_t(1)) {
+  while (node_index >= 2 * cap_start) {
     queue.pop();
     gsl::at(siblings, node_index & 1) = node_hash;
 
@@ -148,7 +245,14 @@ bool MerkleTree<HashT>::VerifyDecommitment(
     std::tie(node_index, node_hash) = queue.front();
   }
 
-  return queue.front().second == merkle_root;
+  // All the remaining nodes are in the cap.
+  for (; !queue.empty(); queue.pop()) {
+    std::tie(node_index, node_hash) = queue.front();
+    if (node_hash != merkle_cap[node_index - cap_start]) {
+      return false;
+    }
+  }
+  return true;
 }
 
 INSTANTIATE_FOR_ALL_HASH_FUNCTIONS(MerkleTree);
@@ -28,6 +28,7 @@
 
 #include "starkware/channel/prover_channel.h"
 #include "starkware/channel/verifier_channel.h"
+#include "starkware/utils/scratch_vector.h"
 
 namespace starkware {
 
@@ -68,16 +69,46 @@ class MerkleTree {
   */
   HashT GetRoot(size_t min_depth_assumed_correct);
 
-  void GenerateDecommitment(const std::set<uint64_t>& queries, ProverChannel* channel) const;
+  /*
+    Same as GetRoot(), but only computes the nodes up to depth cap_height and returns the
+    2^cap_height nodes at that depth (the "cap" of the tree). GetCap(min_depth_assumed_correct, 0)
+    returns the root.
+  */
+  std::vector<HashT> GetCap(size_t min_depth_assumed_correct, size_t cap_height);
+
+  /*
+    Sends the nodes required to authenticate the given queries against the cap of the tree at depth
+    cap_height (see GetCap()). With cap_height = 0 the queries are authenticated against the root.
+  */
+  void GenerateDecommitment(
+      const std::set<uint64_t>& queries, ProverChannel* channel, size_t cap_height = 0) const;
 
   static bool VerifyDecommitment(
       const std::map<uint64_t, HashT>& data_to_verify, uint64_t total_data_length,
       const HashT& merkle_root, VerifierChannel* channel);
 
+  /*
+    Same as above, verifying against a cap (see GetCap()). The height of the cap is
+    log2(merkle_cap.size()).
+  */
+  static bool VerifyDecommitment(
+      const std::map<uint64_t, HashT>& data_to_verify, uint64_t total_data_length,
+      gsl::span<const HashT> merkle_cap, VerifierChannel* channel);
+
   const uint64_t k_data_length;
 
  private:
-  std::vector<HashT> nodes_;
+  /*
+    The nodes of the tree. May be backed by a scratch file (see ScratchVector).
+  */
+  ScratchVector<HashT> nodes_;
+
+  /*
+    Computes the inner nodes of the subtree rooted at subtree_root, assuming the nodes n_layers
+    below subtree_root are correct. Subtrees with different roots at the same depth are independent,
+    and may be computed by different threads.
+  */
+  void ComputeSubtree(uint64_t subtree_root, size_t n_layers);
 
   void SendDecommitmentNode(uint64_t node_index, ProverChannel* channel) const;
 };
@@ -16,6 +16,8 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "starkware/commitment_scheme/utils.h"
 #include "starkware/crypt_tools/template_instantiation.h"
@@ -32,20 +34,34 @@ namespace starkware {
 template <typename HashT>
 MerkleCommitmentSchemeProver<HashT>::MerkleCommitmentSchemeProver(
     size_t n_elements, ProverChannel* channel)
+    : MerkleCommitmentSchemeProver(
+          n_elements, /*n_segments=*/n_elements, /*merkle_cap_height=*/0, channel) {}
+
+template <typename HashT>
+MerkleCommitmentSchemeProver<HashT>::MerkleCommitmentSchemeProver(
+    size_t n_elements, size_t n_segments, size_t merkle_cap_height, ProverChannel* channel)
     : n_elements_(n_elements),
+      n_segments_(n_segments),
+      merkle_cap_height_(merkle_cap_height),
       channel_(channel),
       // Initialize the tree with the number of elements, each element is the hash stored in a leaf.
-      tree_(MerkleTree<HashT>(n_elements_)) {}
+      tree_(MerkleTree<HashT>(n_elements_)) {
+  ASSERT_RELEASE(
+      IsPowerOfTwo(n_segments_) && n_segments_ <= n_elements_,
+      "The number of segments must be a power of 2, and at most the number of elements.");
+  ASSERT_RELEASE(
+      Pow2(merkle_cap_height_) <= n_elements_,
+      "Merkle cap height must be at most the height of the tree.");
+}
 
 template <typename HashT>
 size_t MerkleCommitmentSchemeProver<HashT>::NumSegments() const {
-  // Each segment contains one element.
-  return n_elements_;
+  return n_segments_;
 }
 
 template <typename HashT>
 uint64_t MerkleCommitmentSchemeProver<HashT>::SegmentLengthInElements() const {
-  return 1;
+  return SafeDiv(n_elements_, n_segments_);
 }
 
 template <typename HashT>
@@ -65,8 +81,15 @@ void MerkleCommitmentSchemeProver<HashT>::Commit() {
   // After adding all segments, all inner tree nodes that are at least (tree_height -
   // log2(n_elements_in_segment_)) far from the root - were already computed.
   size_t tree_height = SafeLog2(tree_.k_data_length);
-  const HashT commitment = tree_.GetRoot(tree_height - SafeLog2(SegmentLengthInElements()));
-  channel_->SendCommitmentHash(commitment, "Commitment");
+  const std::vector<HashT> commitment =
+      tree_.GetCap(tree_height - SafeLog2(SegmentLengthInElements()), merkle_cap_height_);
+  if (merkle_cap_height_ == 0) {
+    channel_->SendCommitmentHash(commitment[0], "Commitment");
+    return;
+  }
+  for (size_t i = 0; i < commitment.size(); ++i) {
+    channel_->SendCommitmentHash(commitment[i], "Commitment cap node " + std::to_string(i));
+  }
 }
 
 template <typename HashT>
@@ -79,7 +102,7 @@ std::vector<uint64_t> MerkleCommitmentSchemeProver<HashT>::StartDecommitmentPhas
 template <typename HashT>
 void MerkleCommitmentSchemeProver<HashT>::Decommit(gsl::span<const std::byte> elements_data) {
   ASSERT_RELEASE(elements_data.empty(), "element_data is expected to be empty");
-  tree_.GenerateDecommitment(queries_, channel_);
+  tree_.GenerateDecommitment(queries_, channel_, merkle_cap_height_);
 }
 
 // Verifier part.
@@ -87,11 +110,30 @@ void MerkleCommitmentSchemeProver<HashT>::Decommit(gsl::span<const std::byte> el
 template <typename HashT>
 MerkleCommitmentSchemeVerifier<HashT>::MerkleCommitmentSchemeVerifier(
     uint64_t n_elements, VerifierChannel* channel)
-    : n_elements_(n_elements), channel_(channel) {}
+    : MerkleCommitmentSchemeVerifier(n_elements, /*merkle_cap_height=*/0, channel) {}
+
+template <typename HashT>
+MerkleCommitmentSchemeVerifier<HashT>::MerkleCommitmentSchemeVerifier(
+    uint64_t n_elements, size_t merkle_cap_height, VerifierChannel* channel)
+    : n_elements_(n_elements), merkle_cap_height_(merkle_cap_height), channel_(channel) {
+  ASSERT_RELEASE(
+      Pow2(merkle_cap_height_) <= n_elements_,
+      "Merkle cap height must be at most the height of the tree.");
+}
 
 template <typename HashT>
 void MerkleCommitmentSchemeVerifier<HashT>::ReadCommitment() {
-  commitment_ = channel_->ReceiveCommitmentHash<HashT>("Commitment");
+  if (merkle_cap_height_ == 0) {
+    commitment_ = std::vector<HashT>{channel_->ReceiveCommitmentHash<HashT>("Commitment")};
+    return;
+  }
+  std::vector<HashT> cap;
+  cap.reserve(Pow2(merkle_cap_height_));
+  for (size_t i = 0; i < Pow2(merkle_cap_height_); ++i) {
+    cap.push_back(
+        channel_->ReceiveCommitmentHash<HashT>("Commitment cap node " + std::to_string(i)));
+  }
+  commitment_ = std::move(cap);
 }
 
 template <typename HashT>
@@ -107,7 +149,7 @@ bool MerkleCommitmentSchemeVerifier<HashT>::VerifyIntegrity(
   }
   // Verify decommitment.
   return MerkleTree<HashT>::VerifyDecommitment(
-      hashes_to_verify, n_elements_, *commitment_, channel_);
+      hashes_to_verify, n_elements_, gsl::make_span(*commitment_), channel_);
 }
 
 INSTANTIATE_FOR_ALL_HASH_FUNCTIONS(MerkleCommitmentSchemeProver);
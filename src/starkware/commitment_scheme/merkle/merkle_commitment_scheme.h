@@ -37,6 +37,14 @@ class MerkleCommitmentSchemeProver : public CommitmentSchemeProver {
   static constexpr size_t kSizeOfElement = HashT::kDigestNumBytes;
   MerkleCommitmentSchemeProver(size_t n_elements, ProverChannel* channel);
 
+  /*
+    Commits to the 2^merkle_cap_height nodes at depth merkle_cap_height of the tree (instead of the
+    root), and stops the authentication paths there. The elements are fed in n_segments segments of
+    equal length.
+  */
+  MerkleCommitmentSchemeProver(
+      size_t n_elements, size_t n_segments, size_t merkle_cap_height, ProverChannel* channel);
+
   size_t NumSegments() const override;
   uint64_t SegmentLengthInElements() const override;
   size_t ElementLengthInBytes() const override { return kSizeOfElement; }
@@ -52,6 +60,8 @@ class MerkleCommitmentSchemeProver : public CommitmentSchemeProver {
 
  private:
   const uint64_t n_elements_;
+  const size_t n_segments_;
+  const size_t merkle_cap_height_;
   ProverChannel* channel_;
   MerkleTree<HashT> tree_;
   std::set<uint64_t> queries_;
@@ -62,6 +72,12 @@ class MerkleCommitmentSchemeVerifier : public CommitmentSchemeVerifier {
  public:
   MerkleCommitmentSchemeVerifier(uint64_t n_elements, VerifierChannel* channel);
 
+  /*
+    Verifies against a cap of 2^merkle_cap_height nodes (see MerkleCommitmentSchemeProver).
+  */
+  MerkleCommitmentSchemeVerifier(
+      uint64_t n_elements, size_t merkle_cap_height, VerifierChannel* channel);
+
   void ReadCommitment() override;
   bool VerifyIntegrity(
       const std::map<uint64_t, std::vector<std::byte>>& elements_to_verify) override;
@@ -70,8 +86,9 @@ class MerkleCommitmentSchemeVerifier : public CommitmentSchemeVerifier {
 
  private:
   uint64_t n_elements_;
+  size_t merkle_cap_height_;
   VerifierChannel* channel_;
-  std::optional<HashT> commitment_;
+  std::optional<std::vector<HashT>> commitment_;
 };
 
 }  // namespace starkware
@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <set>
+#include <string>
 
 #include "glog/logging.h"
 #include "gmock/gmock.h"
@@ -78,6 +80,128 @@ TYPED_TEST(MerkleTreeTest, GetRootFromDifferentDepths) {
   }
 }
 
+// Computes the root of a tree with the given leaves, hashing one pair at a time.
+template <typename HashT>
+HashT NaiveRoot(std::vector<HashT> layer) {
+  while (layer.size() > 1) {
+    std::vector<HashT> next_layer;
+    for (size_t i = 0; i < layer.size(); i += 2) {
+      next_layer.push_back(HashT::Hash(layer[i], layer[i + 1]));
+    }
+    layer = std::move(next_layer);
+  }
+  return layer[0];
+}
+
+/*
+  Checks the root of trees that are large enough to be split into subtrees that are computed in
+  parallel, both when the data is fed at once and when it is fed in segments.
+*/
+TYPED_TEST(MerkleTreeTest, LargeTreeMatchesNaiveRoot) {
+  Prng prng;
+  const size_t tree_height = prng.UniformInt(11, 14);
+  std::vector<TypeParam> data = GetRandomData<TypeParam>(Pow2(tree_height), &prng);
+  const TypeParam expected_root = NaiveRoot(data);
+
+  MerkleTree<TypeParam> tree(data.size());
+  tree.AddData(data, 0);
+  EXPECT_EQ(tree.GetRoot(tree_height), expected_root);
+  EXPECT_EQ(tree.GetRoot(0), expected_root);
+
+  // Feed the data in segments, some of which are not aligned to their size. All the nodes above the
+  // segments are recomputed by GetRoot().
+  MerkleTree<TypeParam> segmented_tree(data.size());
+  const gsl::span<const TypeParam> data_span(data);
+  const uint64_t first_segment_size = Pow2(tree_height - 1);
+  const uint64_t second_segment_size = first_segment_size / 2 + 2;
+  segmented_tree.AddData(data_span.subspan(0, first_segment_size), 0);
+  segmented_tree.AddData(
+      data_span.subspan(first_segment_size, second_segment_size), first_segment_size);
+  segmented_tree.AddData(
+      data_span.subspan(first_segment_size + second_segment_size),
+      first_segment_size + second_segment_size);
+  EXPECT_EQ(segmented_tree.GetRoot(tree_height), expected_root);
+}
+
+/*
+  Checks that a tree whose nodes are stored in a scratch file computes the same root and
+  decommitment as an in-memory tree.
+*/
+TYPED_TEST(MerkleTreeTest, ScratchFileNodes) {
+  Prng prng;
+  const size_t tree_height = prng.UniformInt(1, 10);
+  std::vector<TypeParam> data = GetRandomData<TypeParam>(Pow2(tree_height), &prng);
+  MerkleTree<TypeParam> tree(data.size());
+  tree.AddData(data, 0);
+
+  const std::string prev_scratch_dir = FLAGS_scratch_dir;
+  const uint64_t prev_min_scratch_file_size = FLAGS_min_scratch_file_size;
+  FLAGS_scratch_dir = ::testing::TempDir();
+  FLAGS_min_scratch_file_size = 0;
+  MerkleTree<TypeParam> scratch_tree(data.size());
+  FLAGS_scratch_dir = prev_scratch_dir;
+  FLAGS_min_scratch_file_size = prev_min_scratch_file_size;
+  scratch_tree.AddData(data, 0);
+  EXPECT_EQ(scratch_tree.GetRoot(tree_height), tree.GetRoot(tree_height));
+
+  const std::set<uint64_t> queries = {0, data.size() - 1};
+  const Prng channel_prng;
+  NoninteractiveProverChannel prover_channel(channel_prng.Clone());
+  tree.GenerateDecommitment(queries, &prover_channel);
+  NoninteractiveProverChannel scratch_prover_channel(channel_prng.Clone());
+  scratch_tree.GenerateDecommitment(queries, &scratch_prover_channel);
+  EXPECT_EQ(scratch_prover_channel.GetProof(), prover_channel.GetProof());
+}
+
+/*
+  Checks that decommitments against a cap pass verification, are not longer than decommitments
+  against the root, and fail verification if the data or the cap is modified.
+*/
+TYPED_TEST(MerkleTreeTest, QueryVerificationWithCap) {
+  Prng prng;
+  const size_t tree_height = prng.UniformInt(1, 10);
+  const uint64_t data_length = Pow2(tree_height);
+  const size_t cap_height = prng.UniformInt<size_t>(0, tree_height);
+  std::vector<TypeParam> data = GetRandomData<TypeParam>(data_length, &prng);
+  MerkleTree<TypeParam> tree(data_length);
+  tree.AddData(data, 0);
+  const std::vector<TypeParam> cap = tree.GetCap(tree_height, cap_height);
+  ASSERT_EQ(cap.size(), Pow2(cap_height));
+  EXPECT_EQ(tree.GetCap(tree_height, 0), std::vector<TypeParam>{tree.GetRoot(tree_height)});
+
+  std::set<uint64_t> queries;
+  std::map<uint64_t, TypeParam> query_data;
+  while (queries.size() < std::min<size_t>(5, data_length)) {
+    const uint64_t query = prng.UniformInt<uint64_t>(0, data_length - 1);
+    queries.insert(query);
+    query_data[query] = data[query];
+  }
+
+  const Prng channel_prng;
+  NoninteractiveProverChannel prover_channel(channel_prng.Clone());
+  tree.GenerateDecommitment(queries, &prover_channel, cap_height);
+  const std::vector<std::byte> proof = prover_channel.GetProof();
+  NoninteractiveProverChannel root_prover_channel(channel_prng.Clone());
+  tree.GenerateDecommitment(queries, &root_prover_channel);
+  EXPECT_LE(proof.size(), root_prover_channel.GetProof().size());
+
+  NoninteractiveVerifierChannel verifier_channel(channel_prng.Clone(), proof);
+  EXPECT_TRUE(MerkleTree<TypeParam>::VerifyDecommitment(
+      query_data, data_length, gsl::make_span(cap), &verifier_channel));
+
+  std::vector<TypeParam> wrong_cap = cap;
+  wrong_cap[prng.UniformInt<size_t>(0, wrong_cap.size() - 1)] =
+      GetRandomData<TypeParam>(1, &prng)[0];
+  NoninteractiveVerifierChannel wrong_cap_channel(channel_prng.Clone(), proof);
+  EXPECT_FALSE(MerkleTree<TypeParam>::VerifyDecommitment(
+      query_data, data_length, gsl::make_span(wrong_cap), &wrong_cap_channel));
+
+  query_data.begin()->second = GetRandomData<TypeParam>(1, &prng)[0];
+  NoninteractiveVerifierChannel wrong_data_channel(channel_prng.Clone(), proof);
+  EXPECT_FALSE(MerkleTree<TypeParam>::VerifyDecommitment(
+      query_data, data_length, gsl::make_span(cap), &wrong_data_channel));
+}
+
 // Check that different trees get different roots.
 TYPED_TEST(MerkleTreeTest, DifferentRootForDifferentTrees) {
   Prng prng;
@@ -25,7 +25,9 @@
 #include "starkware/channel/verifier_channel_mock.h"
 
 #include "starkware/commitment_scheme/commitment_scheme_mock.h"
+#include "starkware/crypt_tools/blake2s.h"
 #include "starkware/crypt_tools/keccak_256.h"
+#include "starkware/crypt_tools/masked_hash.h"
 #include "starkware/error_handling/test_utils.h"
 #include "starkware/randomness/prng.h"
 
@@ -158,6 +160,48 @@ TEST(PackagingCommitmentSchemeProver, AddSegmentForCommitmentAndCommit) {
   TestAddSegmentForCommitmentAndCommit(4 * HashT::kDigestNumBytes, 1, 8);
 }
 
+/*
+  Checks that PackerHasher::PackAndHash() computes the hashes of the packages (or of the pairs of
+  nodes, for a Merkle layer), one after the other.
+*/
+template <typename HashU>
+void TestPackAndHash(const size_t size_of_element, const uint64_t n_elements) {
+  Prng prng;
+  const PackerHasher<HashU> packer(size_of_element, n_elements);
+  const std::vector<std::byte> data = prng.RandomByteVector(size_of_element * n_elements);
+  const size_t package_size = size_of_element * packer.k_n_elements_in_package;
+  std::vector<std::byte> expected;
+  for (size_t offset = 0; offset < data.size(); offset += package_size) {
+    const auto digest =
+        HashU::HashBytesWithLength(gsl::make_span(data).subspan(offset, package_size)).GetDigest();
+    expected.insert(expected.end(), digest.begin(), digest.end());
+  }
+  EXPECT_EQ(expected, packer.PackAndHash(data, false));
+
+  if (size_of_element == HashU::kDigestNumBytes) {
+    std::vector<std::byte> expected_merkle;
+    for (size_t offset = 0; offset < data.size(); offset += 2 * HashU::kDigestNumBytes) {
+      const auto digest = HashU::Hash(
+                              HashU::InitDigestTo(gsl::make_span(data).subspan(
+                                  offset, HashU::kDigestNumBytes)),
+                              HashU::InitDigestTo(gsl::make_span(data).subspan(
+                                  offset + HashU::kDigestNumBytes, HashU::kDigestNumBytes)))
+                              .GetDigest();
+      expected_merkle.insert(expected_merkle.end(), digest.begin(), digest.end());
+    }
+    EXPECT_EQ(expected_merkle, packer.PackAndHash(data, true));
+  }
+}
+
+TEST(PackerHasher, PackAndHash) {
+  TestPackAndHash<Keccak256>(Keccak256::kDigestNumBytes, 64);
+  TestPackAndHash<Keccak256>(11, 128);
+  TestPackAndHash<Blake2s256>(Blake2s256::kDigestNumBytes, 64);
+  TestPackAndHash<Blake2s256>(3 * Blake2s256::kDigestNumBytes, 16);
+  using MaskedKeccak = MaskedHash<Keccak256, 20, true>;
+  TestPackAndHash<MaskedKeccak>(MaskedKeccak::kDigestNumBytes, 32);
+}
+
 TEST(PackagingCommitmentSchemeProver, AddSegmentForCommitment_AssertsChecks) {
   const size_t size_of_element = 2 * HashT::kDigestNumBytes;
   const uint64_t n_elements_in_segment = 8;
@@ -17,6 +17,7 @@
 #include <algorithm>
 
 #include "starkware/commitment_scheme/utils.h"
+#include "starkware/crypt_tools/batch_hash.h"
 #include "starkware/crypt_tools/template_instantiation.h"
 #include "starkware/error_handling/error_handling.h"
 #include "starkware/math/math.h"
@@ -41,6 +42,19 @@ size_t ComputeNumElementsInPackage(
   return static_cast<size_t>(std::min(Pow2(Log2Ceil(elements_fit_in_package)), max_n_elements));
 }
 
+/*
+  Writes the digests of hashes one after the other to res.
+*/
+template <typename HashT>
+void CopyDigests(gsl::span<const HashT> hashes, gsl::span<std::byte> res) {
+  ASSERT_RELEASE(res.size() == hashes.size() * HashT::kDigestNumBytes, "Wrong output size.");
+  auto it = res.begin();
+  for (const HashT& hash : hashes) {
+    const auto& hash_as_bytes_array = hash.GetDigest();
+    it = std::copy(hash_as_bytes_array.begin(), hash_as_bytes_array.end(), it);
+  }
+}
+
 /*
   Given a sequence of bytes, partitions the sequence to n_elements equal sub-sequences, hashing
   each separately, and returning the resulting sequence of hashes as vector of bytes.
@@ -52,13 +66,15 @@ std::vector<std::byte> HashElements(gsl::span<const std::byte> data, size_t n_el
     return {};
   }
   const size_t element_size = SafeDiv(data.size(), n_elements);
-  std::vector<std::byte> res;
-  res.reserve(n_elements * HashT::kDigestNumBytes);
-  size_t pos = 0;
-  for (size_t i = 0; i < n_elements; ++i, pos += element_size) {
-    const auto hash_as_bytes_array =
-        (HashT::HashBytesWithLength(data.subspan(pos, element_size))).GetDigest();
-    std::copy(hash_as_bytes_array.begin(), hash_as_bytes_array.end(), std::back_inserter(res));
+  std::vector<std::byte> res(n_elements * HashT::kDigestNumBytes);
+  if constexpr (kHasBatchHash<HashT>) {
+    // Write the hashes directly to the result, viewed as hashes (see kHasBatchHash).
+    HashBytesWithLengthBatch<HashT>(
+        data, element_size, gsl::make_span(res).template as_span<HashT>());
+  } else {
+    std::vector<HashT> hashes(n_elements);
+    HashBytesWithLengthBatch<HashT>(data, element_size, hashes);
+    CopyDigests<HashT>(hashes, res);
   }
   return res;
 }
@@ -77,20 +93,16 @@ std::vector<std::byte> HashElementsTwoToOne(gsl::span<const std::byte> data) {
   const size_t elements_to_hash_size = 2 * HashT::kDigestNumBytes;
   const size_t n_elements_next_layer = SafeDiv(data.size(), elements_to_hash_size);
 
-  std::vector<HashT> bytes_as_hash = BytesAsHash<HashT>(data, HashT::kDigestNumBytes);
-
-  // Compute next hash layer.
-  for (size_t i = 0; i < n_elements_next_layer; i++) {
-    bytes_as_hash[i] = HashT::Hash(bytes_as_hash[i * 2], bytes_as_hash[i * 2 + 1]);
-  }
-
-  // Translate to bytes.
-  std::vector<std::byte> res;
-  res.reserve(n_elements_next_layer * HashT::kDigestNumBytes);
-  size_t pos = 0;
-  for (size_t i = 0; i < n_elements_next_layer; ++i, pos += elements_to_hash_size) {
-    const auto hash_as_bytes_array = bytes_as_hash[i].GetDigest();
-    std::copy(hash_as_bytes_array.begin(), hash_as_bytes_array.end(), std::back_inserter(res));
+  std::vector<std::byte> res(n_elements_next_layer * HashT::kDigestNumBytes);
+  if constexpr (kHasBatchHash<HashT>) {
+    // Both the current layer and the next one are viewed in place as hashes (see kHasBatchHash).
+    HashPairsBatch<HashT>(
+        data.template as_span<const HashT>(), gsl::make_span(res).template as_span<HashT>());
+  } else {
+    const std::vector<HashT> bytes_as_hash = BytesAsHash<HashT>(data, HashT::kDigestNumBytes);
+    std::vector<HashT> next_layer(n_elements_next_layer);
+    HashPairsBatch<HashT>(bytes_as_hash, next_layer);
+    CopyDigests<HashT>(next_layer, res);
   }
   return res;
 }
@@ -19,6 +19,7 @@
 #include <limits>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "third_party/gsl/gsl-lite.hpp"
@@ -56,41 +57,39 @@ bool VerifyAllColumnsSameLength(const std::vector<gsl::span<const T>>& columns)
 }
 
 /*
-  Returns serialization of field elements in table, represented by a vector of columns. It stores
-  all elements from same row in a consecutive block of bytes, and keeps the order of rows, and the
-  order of columns inside each row. Formally, if each field element takes 'b' bytes, and there are
-  'c' columns, the element from column 'x' and row 'y' is stored at 'b' bytes, starting of index
-  '(y*c+x)*b'.
+  Writes the serialization of field elements in table, represented by a vector of columns, to
+  serialization. It stores all elements from same row in a consecutive block of bytes, and keeps the
+  order of rows, and the order of columns inside each row. Formally, if each field element takes 'b'
+  bytes, and there are 'c' columns, the element from column 'x' and row 'y' is stored at 'b' bytes,
+  starting of index '(y*c+x)*b'.
 */
 template <typename FieldElementT>
-std::vector<std::byte> SerializeFieldColumnsImpl(
-    const std::vector<gsl::span<const FieldElementT>>& columns) {
+void SerializeFieldColumnsImpl(
+    const std::vector<gsl::span<const FieldElementT>>& columns,
+    gsl::span<std::byte> serialization) {
   ASSERT_RELEASE(VerifyAllColumnsSameLength(columns), "The sizes of the columns must be the same.");
-  const size_t n_columns = columns.size();
   const size_t n_rows = GetNumRows(columns);
   const size_t element_size_in_bytes = FieldElementT::SizeInBytes();
-  const size_t n_bytes_row = columns.size() * element_size_in_bytes;
-
-  std::vector<std::byte> serialization(n_rows * n_bytes_row);
-  auto serialization_span = gsl::make_span(serialization);
+  ASSERT_RELEASE(
+      serialization.size() == n_rows * columns.size() * element_size_in_bytes,
+      "Wrong serialization size.");
 
+  size_t element_byte_idx = 0;
   for (size_t row = 0; row < n_rows; row++) {
-    for (size_t col = 0; col < n_columns; col++) {
-      const size_t element_idx = row * n_columns + col;
-      const size_t element_byte_idx = element_idx * element_size_in_bytes;
-      columns[col][row].ToBytes(
-          serialization_span.subspan(element_byte_idx, element_size_in_bytes));
+    for (const auto& column : columns) {
+      column[row].ToBytes(serialization.subspan(element_byte_idx, element_size_in_bytes));
+      element_byte_idx += element_size_in_bytes;
     }
   }
-
-  return serialization;
 }
 
 /*
-  This is the polymorphic version of SerializeFieldColumnsImpl.
+  This is the polymorphic version of SerializeFieldColumnsImpl. Resizes serialization to the
+  required size, so a buffer which is reused for segments of the same size is not reallocated.
 */
-std::vector<std::byte> SerializeFieldColumns(gsl::span<const ConstFieldElementSpan> segment) {
-  return InvokeFieldTemplateVersion(
+void SerializeFieldColumns(
+    gsl::span<const ConstFieldElementSpan> segment, std::vector<std::byte>* serialization) {
+  InvokeFieldTemplateVersion(
       [&](auto field_tag) {
         using FieldElementT = typename decltype(field_tag)::type;
         std::vector<gsl::span<const FieldElementT>> columns;
@@ -98,7 +97,9 @@ std::vector<std::byte> SerializeFieldColumns(gsl::span<const ConstFieldElementSp
         for (const ConstFieldElementSpan& segment_column : segment) {
           columns.push_back(segment_column.As<FieldElementT>());
         }
-        return SerializeFieldColumnsImpl<FieldElementT>(columns);
+        serialization->resize(
+            GetNumRows(columns) * columns.size() * FieldElementT::SizeInBytes());
+        SerializeFieldColumnsImpl<FieldElementT>(columns, *serialization);
       },
       segment[0].GetField());
 }
@@ -111,10 +112,34 @@ void TableProverImpl::AddSegmentForCommitment(
   ASSERT_RELEASE(
       segment.size() * n_interleaved_columns == n_columns_,
       "segment length is expected to be equal to the number of columns.");
-  commitment_scheme_->AddSegmentForCommitment(SerializeFieldColumns(segment), segment_index);
+  std::vector<std::byte> serialization = AcquireSerializationBuffer();
+  SerializeFieldColumns(segment, &serialization);
+  commitment_scheme_->AddSegmentForCommitment(serialization, segment_index);
+  ReleaseSerializationBuffer(std::move(serialization));
 }
 
-void TableProverImpl::Commit() { commitment_scheme_->Commit(); }
+std::vector<std::byte> TableProverImpl::AcquireSerializationBuffer() {
+  std::lock_guard<std::mutex> lock(serialization_buffers_mutex_);
+  if (serialization_buffers_.empty()) {
+    return {};
+  }
+  std::vector<std::byte> buffer = std::move(serialization_buffers_.back());
+  serialization_buffers_.pop_back();
+  return buffer;
+}
+
+void TableProverImpl::ReleaseSerializationBuffer(std::vector<std::byte> buffer) {
+  std::lock_guard<std::mutex> lock(serialization_buffers_mutex_);
+  serialization_buffers_.push_back(std::move(buffer));
+}
+
+void TableProverImpl::Commit() {
+  commitment_scheme_->Commit();
+  // All the segments were added, so the serialization buffers are no longer needed.
+  std::lock_guard<std::mutex> lock(serialization_buffers_mutex_);
+  serialization_buffers_.clear();
+  serialization_buffers_.shrink_to_fit();
+}
 
 std::vector<uint64_t> TableProverImpl::StartDecommitmentPhase(
     const std::set<RowCol>& data_queries, const std::set<RowCol>& integrity_queries) {
@@ -185,7 +210,9 @@ void TableProverImpl::Decommit(gsl::span<const ConstFieldElementSpan> elements_d
     }
   }
 
-  commitment_scheme_->Decommit(SerializeFieldColumns(elements_data_last_rows));
+  std::vector<std::byte> serialization;
+  SerializeFieldColumns(elements_data_last_rows, &serialization);
+  commitment_scheme_->Decommit(serialization);
 }
 
 }  // namespace starkware
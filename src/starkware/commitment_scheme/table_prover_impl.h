@@ -17,6 +17,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <utility>
 #include <vector>
@@ -49,12 +50,27 @@ class TableProverImpl : public TableProver {
   void Decommit(gsl::span<const ConstFieldElementSpan> elements_data) override;
 
  private:
+  /*
+    Takes a serialization buffer from the pool, or a new one if the pool is empty.
+  */
+  std::vector<std::byte> AcquireSerializationBuffer();
+
+  void ReleaseSerializationBuffer(std::vector<std::byte> buffer);
+
   size_t n_columns_;
   MaybeOwnedPtr<CommitmentSchemeProver> commitment_scheme_;
   ProverChannel* channel_;
   std::set<RowCol> data_queries_;
   std::set<RowCol> integrity_queries_;
   std::set<uint64_t> all_query_rows_;
+
+  /*
+    Serialization buffers of the segments, reused between the segments of a commitment. Segments
+    may be added concurrently, hence the pool holds at most one buffer per concurrently added
+    segment. The buffers are released in Commit().
+  */
+  std::vector<std::vector<std::byte>> serialization_buffers_;
+  std::mutex serialization_buffers_mutex_;
 };
 
 }  // namespace starkware
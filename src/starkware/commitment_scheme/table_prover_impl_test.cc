@@ -95,14 +95,20 @@ class TableProverImplTest : public testing::Test {
     ClearExpectations();
     for (uint64_t segment_idx = 0; segment_idx < n_segments_; segment_idx++) {
       // Every call to AddSegmentForCommitment() is expected to call
-      // commitment_scheme_prover_.AddSegmentForCommitment.
+      // commitment_scheme_prover_.AddSegmentForCommitment with the serialization of the segment,
+      // row by row.
+      const size_t element_size = FieldElementT::SizeInBytes();
+      std::vector<std::byte> serialization(n_rows_per_segment_ * n_columns_ * element_size);
+      for (size_t row = 0; row < n_rows_per_segment_; row++) {
+        for (size_t col = 0; col < n_columns_; col++) {
+          columns_[col].As<FieldElementT>()[segment_idx * n_rows_per_segment_ + row].ToBytes(
+              gsl::make_span(serialization)
+                  .subspan((row * n_columns_ + col) * element_size, element_size));
+        }
+      }
       EXPECT_CALL(
           commitment_scheme_prover_,
-          AddSegmentForCommitment(
-              Property(
-                  &gsl::span<const std::byte>::size,
-                  n_rows_per_segment_ * n_columns_ * FieldElementT::SizeInBytes()),
-              segment_idx));
+          AddSegmentForCommitment(gsl::span<const std::byte>(serialization), segment_idx));
 
       std::vector<ConstFieldElementSpan> segment_span;
       segment_span.reserve(n_columns_);
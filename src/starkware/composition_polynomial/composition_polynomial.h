@@ -24,6 +24,7 @@
 #include "starkware/algebra/polymorphic/field_element_span.h"
 #include "starkware/composition_polynomial/multiplicative_neighbors.h"
 #include "starkware/composition_polynomial/periodic_column.h"
+#include "starkware/error_handling/error_handling.h"
 #include "starkware/utils/maybe_owned_ptr.h"
 
 namespace starkware {
@@ -74,9 +75,57 @@ class CompositionPolynomial {
       const FieldElement& coset_offset, gsl::span<const ConstFieldElementSpan> trace_lde,
       const FieldElementSpan& out_evaluation, uint64_t task_size) const = 0;
 
+  /*
+    Same as EvalOnCosetBitReversedOutput(), on several cosets: out_evaluations[k] is the evaluation
+    on the coset coset_offsets[k]*<group_genertor>, given the columns trace_ldes[k] on that coset.
+    Implementations may schedule the tasks of all the cosets in a single parallel loop, which keeps
+    more threads busy when each coset is small. The default implementation evaluates the cosets one
+    after the other.
+  */
+  virtual void EvalOnCosetsBitReversedOutput(
+      gsl::span<const FieldElement> coset_offsets,
+      gsl::span<const std::vector<ConstFieldElementSpan>> trace_ldes,
+      gsl::span<const FieldElementSpan> out_evaluations, uint64_t task_size) const {
+    ASSERT_RELEASE(
+        trace_ldes.size() == coset_offsets.size() && out_evaluations.size() == coset_offsets.size(),
+        "Wrong number of cosets.");
+    for (size_t i = 0; i < coset_offsets.size(); ++i) {
+      EvalOnCosetBitReversedOutput(coset_offsets[i], trace_ldes[i], out_evaluations[i], task_size);
+    }
+  }
+
+  /*
+    Returns true if EvalOnCosetBitReversedInputAndOutput() is supported, in which case the caller
+    may pass the trace LDE in the (bit reversed) order produced by the LDE manager, without
+    reordering it first.
+  */
+  virtual bool SupportsBitReversedInput() const { return false; }
+
+  /*
+    Same as EvalOnCosetBitReversedOutput(), except that the columns of trace_lde are given in bit
+    reversed order as well: trace_lde[j][i] is the value of column j at the point
+      coset_offset*(group_genertor^{bit_reverse(i)}).
+    Only supported if SupportsBitReversedInput() returns true.
+  */
+  virtual void EvalOnCosetBitReversedInputAndOutput(
+      const FieldElement& /* coset_offset */,
+      gsl::span<const ConstFieldElementSpan> /* trace_lde */,
+      const FieldElementSpan& /* out_evaluation */, uint64_t /* task_size */) const {
+    ASSERT_RELEASE(false, "Bit reversed input is not supported by this composition polynomial.");
+  }
+
   virtual uint64_t GetDegreeBound() const = 0;
 };
 
+namespace composition_polynomial {
+namespace details {
+
+template <typename FieldElementT>
+class CompositionPolynomialImplWorkerMemory;
+
+}  // namespace details
+}  // namespace composition_polynomial
+
 template <typename AirT>
 class CompositionPolynomialImpl : public CompositionPolynomial {
  public:
@@ -123,9 +172,56 @@ class CompositionPolynomialImpl : public CompositionPolynomial {
       const MultiplicativeNeighbors<FieldElementT>& multiplicative_neighbors,
       gsl::span<FieldElementT> out_evaluation, uint64_t task_size) const;
 
+  /*
+    Evaluates all the cosets in a single parallel loop over the pairs (coset, task), so that the
+    threads are not synchronized between the cosets.
+  */
+  void EvalOnCosetsBitReversedOutput(
+      gsl::span<const FieldElement> coset_offsets,
+      gsl::span<const std::vector<ConstFieldElementSpan>> trace_ldes,
+      gsl::span<const FieldElementSpan> out_evaluations, uint64_t task_size) const override;
+
   uint64_t GetDegreeBound() const override { return air_->GetCompositionPolynomialDegreeBound(); }
 
  private:
+  using WorkerMemoryT =
+      composition_polynomial::details::CompositionPolynomialImplWorkerMemory<FieldElementT>;
+
+  /*
+    The neighbors of the rows of a task are gathered kRowBatchSize rows at a time (see
+    MultiplicativeNeighbors::GetNeighborsOfRows()), into a buffer that should fit in the cache.
+  */
+  static constexpr size_t kRowBatchSize = 16;
+
+  /*
+    The values that the tasks of a single coset share, computed once per coset.
+  */
+  struct CosetContext {
+    // The first point of each task.
+    std::vector<FieldElementT> algebraic_offsets;
+    std::vector<std::vector<FieldElementT>> precomp_domain_evals;
+    std::vector<size_t> precomp_domain_masks;
+    std::vector<typename PeriodicColumn<FieldElementT>::CosetEvaluation> periodic_column_cosets;
+  };
+
+  CosetContext PrepareCoset(const FieldElementT& coset_offset, uint64_t task_size) const;
+
+  /*
+    Allocates the memory of each of the threads of the task manager.
+  */
+  std::vector<WorkerMemoryT> AllocateWorkerMemory(
+      const CosetContext& context, uint64_t task_size) const;
+
+  /*
+    Evaluates the points task_idx*task_size, ..., (task_idx+1)*task_size-1 of a coset, and writes
+    them to out_evaluation in bit reversed order.
+  */
+  void EvalTask(
+      const CosetContext& context,
+      const MultiplicativeNeighbors<FieldElementT>& multiplicative_neighbors,
+      gsl::span<FieldElementT> out_evaluation, uint64_t task_idx, uint64_t task_size,
+      WorkerMemoryT* wm) const;
+
   /*
     The constructor is private.
     Users should use the Builder class to build an instance of this class.
@@ -132,8 +132,10 @@ class CompositionPolynomialImplWorkerMemory {
 
  public:
   CompositionPolynomialImplWorkerMemory(
-      size_t periodic_columns_size, size_t precomp_domain_evals_size, size_t batch_inverse_size)
-      : periodic_column_vals(FieldElementT::UninitializedVector(periodic_columns_size)),
+      size_t periodic_columns_size, size_t precomp_domain_evals_size, size_t batch_inverse_size,
+      size_t neighbors_size)
+      : neighbors(FieldElementT::UninitializedVector(neighbors_size)),
+        periodic_column_vals(FieldElementT::UninitializedVector(periodic_columns_size)),
         precomp_domain_evals(FieldElementT::UninitializedVector(precomp_domain_evals_size)),
         batch_inverse_input(
             batch_inverse_size, FractionFieldElement<FieldElementT>::Uninitialized()),
@@ -141,6 +143,9 @@ class CompositionPolynomialImplWorkerMemory {
     periodic_columns_iter.reserve(periodic_columns_size);
   }
 
+  // Pre-allocated space for the neighbors of a batch of rows.
+  std::vector<FieldElementT> neighbors;
+
   std::vector<PeriodicColumnIterator> periodic_columns_iter;
   // Pre-allocated space for periodic column results.
   std::vector<FieldElementT> periodic_column_vals;
@@ -161,9 +166,6 @@ void CompositionPolynomialImpl<AirT>::EvalOnCosetBitReversedOutput(
     const FieldElementT& coset_offset,
     const MultiplicativeNeighbors<FieldElementT>& multiplicative_neighbors,
     gsl::span<FieldElementT> out_evaluation, uint64_t task_size) const {
-  // Precompute useful constants.
-  const size_t log_coset_size = SafeLog2(coset_size_);
-
   // Input verification.
   ASSERT_RELEASE(
       out_evaluation.size() == coset_size_,
@@ -174,99 +176,172 @@ void CompositionPolynomialImpl<AirT>::EvalOnCosetBitReversedOutput(
       multiplicative_neighbors.CosetSize() == coset_size_,
       "Given neighbor_iterator is not of expected length.");
 
-  // Evaluate on coset.
-  FieldElementT point = coset_offset;
+  const CosetContext context = PrepareCoset(coset_offset, task_size);
+  std::vector<WorkerMemoryT> worker_mem = AllocateWorkerMemory(context, task_size);
+
+  TaskManager::GetInstance().ParallelFor(
+      context.algebraic_offsets.size(),
+      [this, &context, &worker_mem, &multiplicative_neighbors, &out_evaluation,
+       task_size](const TaskInfo& task_info) {
+        EvalTask(
+            context, multiplicative_neighbors, out_evaluation, task_info.start_idx, task_size,
+            &worker_mem[TaskManager::GetWorkerId()]);
+      });
+}
+
+template <typename AirT>
+void CompositionPolynomialImpl<AirT>::EvalOnCosetsBitReversedOutput(
+    gsl::span<const FieldElement> coset_offsets,
+    gsl::span<const std::vector<ConstFieldElementSpan>> trace_ldes,
+    gsl::span<const FieldElementSpan> out_evaluations, uint64_t task_size) const {
+  const size_t n_cosets = coset_offsets.size();
+  ASSERT_RELEASE(
+      trace_ldes.size() == n_cosets && out_evaluations.size() == n_cosets,
+      "Wrong number of cosets.");
+  if (n_cosets == 0) {
+    return;
+  }
+
+  std::vector<std::unique_ptr<MultiplicativeNeighbors<FieldElementT>>> all_neighbors;
+  std::vector<gsl::span<FieldElementT>> outputs;
+  all_neighbors.reserve(n_cosets);
+  outputs.reserve(n_cosets);
+  for (size_t coset_idx = 0; coset_idx < n_cosets; ++coset_idx) {
+    std::vector<gsl::span<const FieldElementT>> trace_spans;
+    trace_spans.reserve(trace_ldes[coset_idx].size());
+    for (const ConstFieldElementSpan& span : trace_ldes[coset_idx]) {
+      trace_spans.push_back(span.As<FieldElementT>());
+    }
+    all_neighbors.push_back(
+        std::make_unique<MultiplicativeNeighbors<FieldElementT>>(air_->GetMask(), trace_spans));
+    outputs.push_back(out_evaluations[coset_idx].As<FieldElementT>());
+    ASSERT_RELEASE(
+        outputs.back().size() == coset_size_,
+        "Output span size does not match coset size: " + std::to_string(outputs.back().size()) +
+            " != " + std::to_string(coset_size_));
+  }
 
   TaskManager& task_manager = TaskManager::GetInstance();
-  std::vector<FieldElementT> algebraic_offsets;
-  algebraic_offsets.reserve(DivCeil(coset_size_, task_size));
+  std::vector<CosetContext> contexts(n_cosets);
+  task_manager.ParallelFor(n_cosets, [&](const TaskInfo& task_info) {
+    contexts[task_info.start_idx] =
+        PrepareCoset(coset_offsets[task_info.start_idx].As<FieldElementT>(), task_size);
+  });
+  // The worker memory depends only on the AIR and on the task size, and not on the coset.
+  std::vector<WorkerMemoryT> worker_mem = AllocateWorkerMemory(contexts[0], task_size);
+
+  const size_t n_tasks_per_coset = contexts[0].algebraic_offsets.size();
+  task_manager.ParallelFor(
+      n_cosets * n_tasks_per_coset,
+      [this, &contexts, &worker_mem, &all_neighbors, &outputs, n_tasks_per_coset,
+       task_size](const TaskInfo& task_info) {
+        const size_t coset_idx = task_info.start_idx / n_tasks_per_coset;
+        EvalTask(
+            contexts[coset_idx], *all_neighbors[coset_idx], outputs[coset_idx],
+            task_info.start_idx % n_tasks_per_coset, task_size,
+            &worker_mem[TaskManager::GetWorkerId()]);
+      });
+}
 
-  FieldElementT point_multiplier = Pow(trace_generator_, task_size);
+template <typename AirT>
+auto CompositionPolynomialImpl<AirT>::PrepareCoset(
+    const FieldElementT& coset_offset, uint64_t task_size) const -> CosetContext {
+  CosetContext context;
+
+  context.algebraic_offsets.reserve(DivCeil(coset_size_, task_size));
+  FieldElementT point = coset_offset;
+  const FieldElementT point_multiplier = Pow(trace_generator_, task_size);
   for (uint64_t task_idx_offset = 0; task_idx_offset < coset_size_; task_idx_offset += task_size) {
-    algebraic_offsets.push_back(point);
+    context.algebraic_offsets.push_back(point);
     point *= point_multiplier;
   }
 
-  std::vector<std::vector<FieldElementT>> all_precomp_domain_evals =
+  context.precomp_domain_evals =
       air_->PrecomputeDomainEvalsOnCoset(coset_offset, trace_generator_, point_exponents_, shifts_);
-  std::vector<size_t> precomp_domain_masks;
-  precomp_domain_masks.reserve(all_precomp_domain_evals.size());
-  for (auto& vec : all_precomp_domain_evals) {
-    precomp_domain_masks.push_back(vec.size() - 1);
+  context.precomp_domain_masks.reserve(context.precomp_domain_evals.size());
+  for (auto& vec : context.precomp_domain_evals) {
+    context.precomp_domain_masks.push_back(vec.size() - 1);
+  }
+
+  ProfilingBlock periodic_block("Periodic columns computation.");
+  context.periodic_column_cosets.reserve(periodic_columns_.size());
+  for (const PeriodicColumn<FieldElementT>& column : periodic_columns_) {
+    context.periodic_column_cosets.emplace_back(column.GetCoset(coset_offset, coset_size_));
   }
 
-  using WorkerMemoryT =
-      composition_polynomial::details::CompositionPolynomialImplWorkerMemory<FieldElementT>;
+  return context;
+}
+
+template <typename AirT>
+auto CompositionPolynomialImpl<AirT>::AllocateWorkerMemory(
+    const CosetContext& context, uint64_t task_size) const -> std::vector<WorkerMemoryT> {
+  const size_t n_threads = TaskManager::GetInstance().GetNumThreads();
+  const size_t mask_size = air_->GetMask().size();
   std::vector<WorkerMemoryT> worker_mem;
-  worker_mem.reserve(task_manager.GetNumThreads());
-  for (size_t i = 0; i < task_manager.GetNumThreads(); ++i) {
-    worker_mem.emplace_back(periodic_columns_.size(), all_precomp_domain_evals.size(), task_size);
+  worker_mem.reserve(n_threads);
+  for (size_t i = 0; i < n_threads; ++i) {
+    worker_mem.emplace_back(
+        periodic_columns_.size(), context.precomp_domain_evals.size(), task_size,
+        kRowBatchSize * mask_size);
   }
+  return worker_mem;
+}
 
-  std::vector<typename PeriodicColumn<FieldElementT>::CosetEvaluation> periodic_column_cosets;
-  {
-    ProfilingBlock periodic_block("Periodic columns computation.");
+template <typename AirT>
+void CompositionPolynomialImpl<AirT>::EvalTask(
+    const CosetContext& context,
+    const MultiplicativeNeighbors<FieldElementT>& multiplicative_neighbors,
+    gsl::span<FieldElementT> out_evaluation, uint64_t task_idx, uint64_t task_size,
+    WorkerMemoryT* wm) const {
+  const size_t log_coset_size = SafeLog2(coset_size_);
+  const uint64_t initial_point_idx = task_size * task_idx;
+  auto point = context.algebraic_offsets[task_idx];
+
+  wm->periodic_columns_iter.clear();
+  for (const auto& column_coset : context.periodic_column_cosets) {
+    wm->periodic_columns_iter.push_back(column_coset.begin() + initial_point_idx);
+  }
 
-    periodic_column_cosets.reserve(periodic_columns_.size());
-    for (const PeriodicColumn<FieldElementT>& column : periodic_columns_) {
-      periodic_column_cosets.emplace_back(column.GetCoset(coset_offset, coset_size_));
+  const size_t actual_task_size = std::min(task_size, coset_size_ - initial_point_idx);
+  const size_t end_of_coset_index = initial_point_idx + actual_task_size;
+  const size_t mask_size = multiplicative_neighbors.MaskSize();
+
+  for (size_t batch_start = initial_point_idx; batch_start < end_of_coset_index;
+       batch_start += kRowBatchSize) {
+    const size_t batch_size = std::min(kRowBatchSize, end_of_coset_index - batch_start);
+    multiplicative_neighbors.GetNeighborsOfRows(batch_start, batch_size, wm->neighbors);
+
+    for (size_t row = 0; row < batch_size; ++row) {
+      const size_t point_idx = batch_start + row;
+      const auto neighbors =
+          gsl::span<const FieldElementT>(wm->neighbors).subspan(row * mask_size, mask_size);
+      // Evaluate periodic columns.
+      for (size_t i = 0; i < periodic_columns_.size(); ++i) {
+        wm->periodic_column_vals[i] = *wm->periodic_columns_iter[i];
+        ++wm->periodic_columns_iter[i];
+      }
+      for (size_t i = 0; i < context.precomp_domain_evals.size(); ++i) {
+        wm->precomp_domain_evals[i] =
+            context.precomp_domain_evals[i][point_idx & context.precomp_domain_masks[i]];
+      }
+      wm->batch_inverse_input[point_idx - initial_point_idx] = air_->ConstraintsEval(
+          neighbors, wm->periodic_column_vals, coefficients_, point, shifts_,
+          wm->precomp_domain_evals);
+
+      // Advance evaluation point.
+      point *= trace_generator_;
     }
   }
 
-  task_manager.ParallelFor(
-      algebraic_offsets.size(),
-      [this, &all_precomp_domain_evals, &precomp_domain_masks, &algebraic_offsets,
-       &periodic_column_cosets, &worker_mem, &multiplicative_neighbors, &out_evaluation,
-       log_coset_size, task_size](const TaskInfo& task_info) {
-        uint64_t initial_point_idx = task_size * task_info.start_idx;
-        auto point = algebraic_offsets[task_info.start_idx];
-        WorkerMemoryT& wm = worker_mem[TaskManager::GetWorkerId()];
-
-        wm.periodic_columns_iter.clear();
-        for (const auto& column_coset : periodic_column_cosets) {
-          wm.periodic_columns_iter.push_back(column_coset.begin() + initial_point_idx);
-        }
-
-        typename MultiplicativeNeighbors<FieldElementT>::Iterator neighbors_iter =
-            multiplicative_neighbors.begin();
-        neighbors_iter += static_cast<size_t>(initial_point_idx);
-
-        const size_t actual_task_size = std::min(task_size, coset_size_ - initial_point_idx);
-        const size_t end_of_coset_index = initial_point_idx + actual_task_size;
-
-        for (size_t point_idx = initial_point_idx; point_idx < end_of_coset_index; point_idx++) {
-          ASSERT_RELEASE(
-              neighbors_iter != multiplicative_neighbors.end(),
-              "neighbors_iter reached the end of the iterator unexpectedly");
-          auto neighbors = *neighbors_iter;
-          // Evaluate periodic columns.
-          for (size_t i = 0; i < periodic_columns_.size(); ++i) {
-            wm.periodic_column_vals[i] = *wm.periodic_columns_iter[i];
-            ++wm.periodic_columns_iter[i];
-          }
-          for (size_t i = 0; i < all_precomp_domain_evals.size(); ++i) {
-            wm.precomp_domain_evals[i] =
-                all_precomp_domain_evals[i][point_idx & precomp_domain_masks[i]];
-          }
-          wm.batch_inverse_input[point_idx - initial_point_idx] = air_->ConstraintsEval(
-              neighbors, wm.periodic_column_vals, coefficients_, point, shifts_,
-              wm.precomp_domain_evals);
-
-          // Advance evaluation point.
-          point *= trace_generator_;
-          ++neighbors_iter;
-        }
-
-        auto in_span = gsl::span<const FractionFieldElement<FieldElementT>>(wm.batch_inverse_input)
-                           .first(actual_task_size);
-        auto out_span = gsl::span<FieldElementT>(wm.batch_inverse_output).first(actual_task_size);
-        FractionFieldElement<FieldElementT>::BatchToBaseFieldElement(in_span, out_span);
-
-        for (size_t point_idx = initial_point_idx; point_idx < end_of_coset_index; point_idx++) {
-          out_evaluation[BitReverse(point_idx, log_coset_size)] =
-              wm.batch_inverse_output[point_idx - initial_point_idx];
-        }
-      });
+  auto in_span = gsl::span<const FractionFieldElement<FieldElementT>>(wm->batch_inverse_input)
+                     .first(actual_task_size);
+  auto out_span = gsl::span<FieldElementT>(wm->batch_inverse_output).first(actual_task_size);
+  FractionFieldElement<FieldElementT>::BatchToBaseFieldElement(in_span, out_span);
+
+  for (size_t point_idx = initial_point_idx; point_idx < end_of_coset_index; point_idx++) {
+    out_evaluation[BitReverse(point_idx, log_coset_size)] =
+        wm->batch_inverse_output[point_idx - initial_point_idx];
+  }
 }
 
 }  // namespace starkware
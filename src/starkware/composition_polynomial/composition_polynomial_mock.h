@@ -31,6 +31,12 @@ class CompositionPolynomialMock : public CompositionPolynomial {
       EvalOnCosetBitReversedOutput, void(
                                         const FieldElement&, gsl::span<const ConstFieldElementSpan>,
                                         const FieldElementSpan&, uint64_t));
+  MOCK_CONST_METHOD0(SupportsBitReversedInput, bool());
+  MOCK_CONST_METHOD4(
+      EvalOnCosetBitReversedInputAndOutput,
+      void(
+          const FieldElement&, gsl::span<const ConstFieldElementSpan>, const FieldElementSpan&,
+          uint64_t));
   MOCK_CONST_METHOD0(GetDegreeBound, uint64_t());
 };
 
@@ -86,22 +86,21 @@ PeriodicColumn<FieldElementT> RandomPeriodicColumn(
       Pow2(log_coset_size), 1);
 }
 
-void TestEvalCompositionOnCoset(const size_t log_coset_size, const uint64_t task_size) {
-  Prng prng;
-
-  const size_t n_columns = prng.UniformInt(1, 20);
+/*
+  Sets a single constraint, which involves a periodic column and two rows of the first column, on
+  air.
+*/
+void SetTestConstraint(DummyAirT* air, Prng* prng, size_t log_coset_size, size_t n_columns) {
   const size_t trace_length = Pow2(log_coset_size);
+  air->n_constraints = 1;
+  air->periodic_columns.push_back(RandomPeriodicColumn(prng, log_coset_size));
+  air->n_columns = n_columns;
+  air->mask = {{{0, 0}, {1, 0}}};
 
-  DummyAir<FieldElementT> air(trace_length);
-  air.n_constraints = 1;
-  air.periodic_columns.push_back(RandomPeriodicColumn(&prng, log_coset_size));
-  air.n_columns = n_columns;
-  air.mask = {{{0, 0}, {1, 0}}};
-
-  air.composition_polynomial_degree_bound = 2 * trace_length;
+  air->composition_polynomial_degree_bound = 2 * trace_length;
 
-  air.point_exponents = {trace_length};  // Used to compute everywhere.
-  air.constraints = {
+  air->point_exponents = {trace_length};  // Used to compute everywhere.
+  air->constraints = {
       [](gsl::span<const FieldElementT> neighbors, gsl::span<const FieldElementT> periodic_columns,
          gsl::span<const FieldElementT> random_coefficients, const FieldElementT& /*point*/,
          gsl::span<const FieldElementT> /*gen_power*/,
@@ -117,6 +116,16 @@ void TestEvalCompositionOnCoset(const size_t log_coset_size, const uint64_t task
         return FractionFieldElement<FieldElementT>(
             constraint * random_coefficients[0] * numerator, denominator);
       }};
+}
+
+void TestEvalCompositionOnCoset(const size_t log_coset_size, const uint64_t task_size) {
+  Prng prng;
+
+  const size_t n_columns = prng.UniformInt(1, 20);
+  const size_t trace_length = Pow2(log_coset_size);
+
+  DummyAir<FieldElementT> air(trace_length);
+  SetTestConstraint(&air, &prng, log_coset_size, n_columns);
 
   const FieldElementT coset_group_generator = GetSubGroupGenerator<FieldElementT>(trace_length);
 
@@ -160,6 +169,52 @@ void TestEvalCompositionOnCoset(const size_t log_coset_size, const uint64_t task
   }
 }
 
+/*
+  Checks that evaluating n_cosets cosets together gives the same results as evaluating each of them
+  separately.
+*/
+void TestEvalCompositionOnCosets(
+    const size_t log_coset_size, const uint64_t task_size, const size_t n_cosets) {
+  Prng prng;
+
+  const size_t n_columns = prng.UniformInt(1, 20);
+  const size_t trace_length = Pow2(log_coset_size);
+  const Field field = Field::Create<FieldElementT>();
+
+  DummyAir<FieldElementT> air(trace_length);
+  SetTestConstraint(&air, &prng, log_coset_size, n_columns);
+
+  const FieldElementVector coefficients = FieldElementVector::Make(
+      prng.RandomFieldElementVector<FieldElementT>(air.NumRandomCoefficients()));
+  const std::unique_ptr<CompositionPolynomial> poly = air.CreateCompositionPolynomial(
+      FieldElement(GetSubGroupGenerator<FieldElementT>(trace_length)), coefficients);
+
+  std::vector<FieldElement> coset_offsets;
+  std::vector<std::vector<FieldElementVector>> trace_ldes(n_cosets);
+  std::vector<std::vector<ConstFieldElementSpan>> trace_lde_spans(n_cosets);
+  std::vector<FieldElementVector> evaluations;
+  std::vector<FieldElementSpan> evaluation_spans;
+  for (size_t coset_idx = 0; coset_idx < n_cosets; ++coset_idx) {
+    coset_offsets.emplace_back(FieldElementT::RandomElement(&prng));
+    for (size_t i = 0; i < n_columns; ++i) {
+      trace_ldes[coset_idx].push_back(
+          FieldElementVector::Make(prng.RandomFieldElementVector<FieldElementT>(trace_length)));
+    }
+    trace_lde_spans[coset_idx].assign(trace_ldes[coset_idx].begin(), trace_ldes[coset_idx].end());
+    evaluations.push_back(FieldElementVector::MakeUninitialized(field, trace_length));
+  }
+  evaluation_spans.assign(evaluations.begin(), evaluations.end());
+
+  poly->EvalOnCosetsBitReversedOutput(coset_offsets, trace_lde_spans, evaluation_spans, task_size);
+
+  for (size_t coset_idx = 0; coset_idx < n_cosets; ++coset_idx) {
+    FieldElementVector expected = FieldElementVector::MakeUninitialized(field, trace_length);
+    poly->EvalOnCosetBitReversedOutput(
+        coset_offsets[coset_idx], trace_lde_spans[coset_idx], expected, task_size);
+    EXPECT_EQ(expected, evaluations[coset_idx]);
+  }
+}
+
 TEST(CompositionPolynomial, EvalCompositionOnCoset) {
   Prng prng;
   TestEvalCompositionOnCoset(prng.UniformInt(5, 8), Pow2(4));
@@ -170,5 +225,17 @@ TEST(CompositionPolynomial, EvalCompositionOnCoset) {
   TestEvalCompositionOnCoset(4, Pow2(5));
 }
 
+TEST(CompositionPolynomial, EvalCompositionOnCosets) {
+  Prng prng;
+  TestEvalCompositionOnCosets(prng.UniformInt(5, 8), Pow2(4), 3);
+
+  // task_size is not a power of 2.
+  TestEvalCompositionOnCosets(prng.UniformInt(5, 8), 20, 4);
+  // task_size > coset_size.
+  TestEvalCompositionOnCosets(4, Pow2(5), 2);
+  // A single coset.
+  TestEvalCompositionOnCosets(5, Pow2(2), 1);
+}
+
 }  // namespace
 }  // namespace starkware
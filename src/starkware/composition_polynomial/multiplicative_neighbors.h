@@ -57,6 +57,16 @@ class MultiplicativeNeighbors {
 
   uint64_t CosetSize() const { return coset_size_; }
 
+  size_t MaskSize() const { return mask_.size(); }
+
+  /*
+    Writes the neighbors of the rows first_row, ..., first_row + n_rows - 1 to out, one row after the
+    other: out[r * MaskSize() + i] is the i-th neighbor of the row first_row + r.
+    Unlike the iterator, which gathers the neighbors of one row at a time, this reads each column
+    sequentially over all the rows, and is faster when n_rows is larger than 1.
+  */
+  void GetNeighborsOfRows(uint64_t first_row, size_t n_rows, gsl::span<FieldElementT> out) const;
+
  private:
   const std::vector<std::pair<int64_t, uint64_t>> mask_;
   const uint64_t coset_size_;
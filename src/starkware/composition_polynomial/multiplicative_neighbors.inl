@@ -49,6 +49,23 @@ MultiplicativeNeighbors<FieldElementT>::MultiplicativeNeighbors(
   }
 }
 
+template <typename FieldElementT>
+void MultiplicativeNeighbors<FieldElementT>::GetNeighborsOfRows(
+    uint64_t first_row, size_t n_rows, gsl::span<FieldElementT> out) const {
+  const size_t mask_size = mask_.size();
+  ASSERT_RELEASE(first_row + n_rows <= coset_size_, "Rows are out of range.");
+  ASSERT_RELEASE(out.size() >= n_rows * mask_size, "Output span is too small.");
+  for (size_t i = 0; i < mask_size; ++i) {
+    const auto& [row_offset, column_index] = mask_[i];
+    const gsl::span<const FieldElementT> column = trace_lde_[column_index];
+    size_t row = (first_row + row_offset) & neighbor_wraparound_mask_;
+    for (size_t r = 0; r < n_rows; ++r) {
+      out[r * mask_size + i] = column[row];
+      row = (row + 1) & neighbor_wraparound_mask_;
+    }
+  }
+}
+
 template <typename FieldElementT>
 MultiplicativeNeighbors<FieldElementT>::Iterator::Iterator(
     const MultiplicativeNeighbors* parent, size_t idx)
@@ -14,6 +14,7 @@
 
 #include "starkware/composition_polynomial/multiplicative_neighbors.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "gmock/gmock.h"
@@ -59,6 +60,41 @@ TEST(MultiplicativeNeighbors, Correctness) {
               }));
 }
 
+TEST(MultiplicativeNeighbors, GetNeighborsOfRows) {
+  const size_t trace_length = 16;
+  const size_t n_columns = 3;
+  const std::array<std::pair<int64_t, uint64_t>, 6> mask = {
+      {{0, 0}, {-1, 1}, {1, 2}, {5, 0}, {-9, 2}, {17, 1}}};
+  std::vector<std::vector<FieldElementT>> trace;
+  Prng prng;
+  trace.reserve(n_columns);
+  for (size_t i = 0; i < n_columns; ++i) {
+    trace.push_back(prng.RandomFieldElementVector<FieldElementT>(trace_length));
+  }
+  MultiplicativeNeighbors<FieldElementT> neighbors(
+      mask, std::vector<gsl::span<const FieldElementT>>(trace.begin(), trace.end()));
+  std::vector<FieldElementT> expected;
+  for (auto vals : neighbors) {
+    expected.insert(expected.end(), vals.begin(), vals.end());
+  }
+
+  std::vector<FieldElementT> result = FieldElementT::UninitializedVector(expected.size());
+  for (size_t first_row = 0; first_row < trace_length; ++first_row) {
+    for (size_t n_rows = 0; first_row + n_rows <= trace_length; ++n_rows) {
+      neighbors.GetNeighborsOfRows(first_row, n_rows, result);
+      EXPECT_TRUE(std::equal(
+          result.begin(), result.begin() + n_rows * mask.size(),
+          expected.begin() + first_row * mask.size()));
+    }
+  }
+
+  EXPECT_ASSERT(
+      neighbors.GetNeighborsOfRows(trace_length - 1, 2, result), HasSubstr("out of range"));
+  EXPECT_ASSERT(
+      neighbors.GetNeighborsOfRows(0, 2, gsl::make_span(result).first(mask.size())),
+      HasSubstr("too small"));
+}
+
 TEST(MultiplicativeNeighbors, InvalidMask) {
   const size_t trace_length = 8;
   const size_t n_columns = 3;
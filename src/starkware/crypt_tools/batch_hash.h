@@ -0,0 +1,123 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#ifndef STARKWARE_CRYPT_TOOLS_BATCH_HASH_H_
+#define STARKWARE_CRYPT_TOOLS_BATCH_HASH_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "third_party/gsl/gsl-lite.hpp"
+
+#include "starkware/error_handling/error_handling.h"
+
+namespace starkware {
+
+namespace batch_hash {
+namespace details {
+
+/*
+  Checks whether HashT has a static HashBytesWithLengthBatch() function (see Keccak256, for
+  example), which hashes several messages together using a multi-buffer implementation.
+  Such hash functions must satisfy Hash(a, b) == HashBytesWithLength(a.GetDigest() || b.GetDigest()).
+*/
+template <typename HashT, typename = void>
+struct HasHashBytesWithLengthBatch : std::false_type {};
+
+template <typename HashT>
+struct HasHashBytesWithLengthBatch<
+    HashT, std::void_t<decltype(HashT::HashBytesWithLengthBatch(
+               std::declval<gsl::span<const std::byte>>(), std::declval<size_t>(),
+               std::declval<gsl::span<HashT>>()))>> : std::true_type {};
+
+/*
+  Checks whether HashT has a static HashPairsBatch() function (see Pedersen, for example), which
+  hashes several pairs of nodes together.
+*/
+template <typename HashT, typename = void>
+struct HasHashPairsBatch : std::false_type {};
+
+template <typename HashT>
+struct HasHashPairsBatch<
+    HashT, std::void_t<decltype(HashT::HashPairsBatch(
+               std::declval<gsl::span<const HashT>>(), std::declval<gsl::span<HashT>>()))>>
+    : std::true_type {};
+
+template <typename HashT>
+constexpr bool HasBatchHash() {
+  if constexpr (HasHashBytesWithLengthBatch<HashT>::value) {
+    static_assert(
+        sizeof(HashT) == HashT::kDigestNumBytes,
+        "A HashT with a multi-buffer implementation must hold only its digest.");
+    return true;
+  }
+  return false;
+}
+
+}  // namespace details
+}  // namespace batch_hash
+
+/*
+  True if HashT has a multi-buffer implementation. Such a HashT must hold only its digest (this is
+  asserted at compile time), so a sequence of digests in memory may be viewed as a span of HashT
+  without copying, and vice versa.
+*/
+template <typename HashT>
+constexpr bool kHasBatchHash = batch_hash::details::HasBatchHash<HashT>();
+
+/*
+  Hashes outputs.size() messages of message_size bytes each, which are given one after the other in
+  bytes:
+    outputs[i] = HashT::HashBytesWithLength(bytes.subspan(i * message_size, message_size)).
+  Uses the multi-buffer implementation of HashT if it has one.
+*/
+template <typename HashT>
+void HashBytesWithLengthBatch(
+    gsl::span<const std::byte> bytes, size_t message_size, gsl::span<HashT> outputs) {
+  if constexpr (kHasBatchHash<HashT>) {
+    HashT::HashBytesWithLengthBatch(bytes, message_size, outputs);
+  } else {
+    ASSERT_RELEASE(bytes.size() == message_size * outputs.size(), "Wrong input size.");
+    for (size_t i = 0; i < outputs.size(); ++i) {
+      outputs[i] = HashT::HashBytesWithLength(bytes.subspan(i * message_size, message_size));
+    }
+  }
+}
+
+/*
+  Hashes pairs of consecutive nodes: outputs[i] = HashT::Hash(inputs[2 * i], inputs[2 * i + 1]).
+  Uses the multi-buffer implementation of HashT, or its HashPairsBatch(), if it has one, in which
+  case independent pairs are hashed together. inputs and outputs must not overlap.
+*/
+template <typename HashT>
+void HashPairsBatch(gsl::span<const HashT> inputs, gsl::span<HashT> outputs) {
+  ASSERT_RELEASE(inputs.size() == 2 * outputs.size(), "Wrong number of inputs.");
+  if constexpr (kHasBatchHash<HashT>) {
+    // The digests of consecutive nodes are consecutive in memory (see kHasBatchHash).
+    HashT::HashBytesWithLengthBatch(
+        inputs.template as_span<const std::byte>(), 2 * HashT::kDigestNumBytes, outputs);
+  } else if constexpr (batch_hash::details::HasHashPairsBatch<HashT>::value) {
+    HashT::HashPairsBatch(inputs, outputs);
+  } else {
+    for (size_t i = 0; i < outputs.size(); ++i) {
+      outputs[i] = HashT::Hash(inputs[2 * i], inputs[2 * i + 1]);
+    }
+  }
+}
+
+}  // namespace starkware
+
+#endif  // STARKWARE_CRYPT_TOOLS_BATCH_HASH_H_
@@ -50,6 +50,14 @@ class Blake2s {
 
   static const Blake2s HashBytesWithLength(gsl::span<const std::byte> bytes);
 
+  /*
+    Hashes outputs.size() messages of message_size bytes each, which are given one after the other
+    in bytes. Groups of 8 messages are hashed together using AVX2 (see
+    multi_buffer/blake2s_times8.h).
+  */
+  static void HashBytesWithLengthBatch(
+      gsl::span<const std::byte> bytes, size_t message_size, gsl::span<Blake2s> outputs);
+
   bool operator==(const Blake2s& other) const;
   bool operator!=(const Blake2s& other) const;
   const std::array<std::byte, kDigestNumBytes>& GetDigest() const { return buffer_; }
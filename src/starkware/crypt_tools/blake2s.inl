@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions
 // and limitations under the License.
 
+#include "starkware/crypt_tools/multi_buffer/blake2s_times8.h"
 #include "starkware/crypt_tools/utils.h"
 #include "starkware/error_handling/error_handling.h"
 #include "starkware/utils/to_from_string.h"
@@ -104,6 +105,27 @@ const Blake2s<DigestNumBits> Blake2s<DigestNumBits>::HashBytesWithLength(
   return result;
 }
 
+template <size_t DigestNumBits>
+void Blake2s<DigestNumBits>::HashBytesWithLengthBatch(
+    gsl::span<const std::byte> bytes, size_t message_size, gsl::span<Blake2s> outputs) {
+  ASSERT_RELEASE(bytes.size() == message_size * outputs.size(), "Wrong input size.");
+  size_t first = 0;
+#ifndef NO_AVX
+  constexpr size_t kBatchSize = 8;
+  static_assert(sizeof(Blake2s) == kDigestNumBytes, "Blake2s must hold only its digest.");
+  for (; first + kBatchSize <= outputs.size(); first += kBatchSize) {
+    multi_buffer::Blake2sTimes8(
+        bytes.subspan(first * message_size, kBatchSize * message_size), message_size,
+        kDigestNumBytes, outputs.subspan(first, kBatchSize).template as_span<std::byte>());
+  }
+#endif
+
+  // Hash the remaining messages one by one.
+  for (; first < outputs.size(); ++first) {
+    outputs[first] = HashBytesWithLength(bytes.subspan(first * message_size, message_size));
+  }
+}
+
 template <size_t DigestNumBits>
 bool Blake2s<DigestNumBits>::operator==(const Blake2s<DigestNumBits>& other) const {
   return buffer_ == other.buffer_;
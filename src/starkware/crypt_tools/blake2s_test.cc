@@ -87,6 +87,26 @@ TEST(Blake2s256, OutStreamOperator) {
   EXPECT_EQ("0xbe8c6777e88d287dd927975327dd4214d199a1a1b67fe2e26666cc336533666a", ss.str());
 }
 
+TEST(Blake2s256, HashBytesWithLengthBatch) {
+  Prng prng;
+  // Message sizes around the block size (64 bytes) and numbers of messages that are not a multiple
+  // of the batch size.
+  for (const size_t message_size : {0, 7, 63, 64, 65, 200}) {
+    for (const size_t n_messages : {1, 8, 19}) {
+      const std::vector<std::byte> bytes = prng.RandomByteVector(message_size * n_messages);
+      std::vector<Blake2s256> outputs(n_messages);
+      Blake2s256::HashBytesWithLengthBatch(bytes, message_size, outputs);
+      std::vector<Blake2s160> outputs160(n_messages);
+      Blake2s160::HashBytesWithLengthBatch(bytes, message_size, outputs160);
+      for (size_t i = 0; i < n_messages; ++i) {
+        const auto message = gsl::make_span(bytes).subspan(i * message_size, message_size);
+        EXPECT_EQ(outputs[i], Blake2s256::HashBytesWithLength(message));
+        EXPECT_EQ(outputs160[i], Blake2s160::HashBytesWithLength(message));
+      }
+    }
+  }
+}
+
 }  // namespace
 
 }  // namespace starkware
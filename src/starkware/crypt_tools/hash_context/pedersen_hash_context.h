@@ -15,13 +15,18 @@
 #ifndef STARKWARE_CRYPT_TOOLS_HASH_CONTEXT_PEDERSEN_HASH_CONTEXT_H_
 #define STARKWARE_CRYPT_TOOLS_HASH_CONTEXT_PEDERSEN_HASH_CONTEXT_H_
 
+#include <array>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "starkware/crypt_tools/hash_context/hash_context.h"
 
-#include "starkware/air/components/ec_subset_sum/ec_subset_sum.h"
+#include "starkware/algebra/elliptic_curve/elliptic_curve.h"
 #include "starkware/algebra/elliptic_curve/elliptic_curve_constants.h"
 #include "starkware/algebra/fields/prime_field_element.h"
+#include "starkware/error_handling/error_handling.h"
+#include "starkware/math/math.h"
 
 namespace starkware {
 
@@ -36,6 +41,13 @@ namespace starkware {
 */
 template <typename FieldElementT>
 struct PedersenHashContext : public HashContext<FieldElementT> {
+  /*
+    The bits of each hash input are handled in windows of kWindowBits bits. The sums of all the
+    subsets of the points of each window are precomputed (on the first hash), so that each window
+    costs a single point addition.
+  */
+  static constexpr size_t kWindowBits = 8;
+
   uint64_t n_element_bits;
   uint64_t ec_subset_sum_height;
   size_t n_inputs;
@@ -49,7 +61,8 @@ struct PedersenHashContext : public HashContext<FieldElementT> {
         ec_subset_sum_height(ec_subset_sum_height),
         n_inputs(n_inputs),
         shift_point(shift_point),
-        points(points) {
+        points(points),
+        window_tables_(std::make_shared<WindowTables>()) {
     ASSERT_RELEASE(
         points.size() == n_element_bits * n_inputs,
         "points should be of length n_inputs * element_bits.");
@@ -59,18 +72,8 @@ struct PedersenHashContext : public HashContext<FieldElementT> {
     Calculates the hash of the given inputs.
   */
   FieldElementT Hash(const gsl::span<const FieldElementT> hash_inputs) const {
-    ASSERT_RELEASE(
-        points.size() == n_element_bits * hash_inputs.size(),
-        "The number of points is not equal to the number of bits in total in the hash input.");
-    EcPoint<FieldElementT> cur_sum = shift_point;
-    for (size_t i = 0; i < hash_inputs.size(); ++i) {
-      const uint64_t offset = n_element_bits * i;
-      auto points_span = gsl::make_span(points);
-
-      cur_sum = EcSubsetSumComponent<FieldElementT>::Hash(
-          cur_sum, points_span.subspan(offset, n_element_bits), hash_inputs[i]);
-    }
-    return cur_sum.x;
+    const ProjectivePoint sum = HashProjective(hash_inputs);
+    return sum.x / sum.z;
   }
 
   /*
@@ -79,6 +82,50 @@ struct PedersenHashContext : public HashContext<FieldElementT> {
   FieldElementT Hash(const FieldElementT& x, const FieldElementT& y) const override {
     return Hash(std::array<FieldElementT, 2>({x, y}));
   }
+
+  /*
+    Computes outputs[i] = Hash(inputs[2 * i], inputs[2 * i + 1]) for all i. The hashes are computed
+    in parallel, in chunks that share a single field inversion.
+  */
+  void HashPairs(gsl::span<const FieldElementT> inputs, gsl::span<FieldElementT> outputs) const;
+
+ private:
+  /*
+    A point (x / z, y / z), which allows adding points without field inversions.
+  */
+  struct ProjectivePoint {
+    FieldElementT x;
+    FieldElementT y;
+    FieldElementT z;
+  };
+
+  /*
+    The precomputed sums, computed once and shared between copies of the context.
+    The sums of window i are stored at points[i * 2^kWindowBits + v] for 0 < v < 2^kWindowBits,
+    where the window of bit j of input k is (k * NumWindowsPerInput() + j / kWindowBits).
+  */
+  struct WindowTables {
+    std::once_flag once;
+    std::vector<EcPoint<FieldElementT>> points;
+  };
+
+  size_t NumWindowsPerInput() const { return DivCeil(n_element_bits, kWindowBits); }
+
+  const std::vector<EcPoint<FieldElementT>>& GetWindowTables() const;
+
+  std::vector<EcPoint<FieldElementT>> ComputeWindowTables() const;
+
+  /*
+    Returns shift_point plus the sum of the points selected by the bits of hash_inputs.
+  */
+  ProjectivePoint HashProjective(gsl::span<const FieldElementT> hash_inputs) const;
+
+  /*
+    Adds an affine point to sum. The points must have different x coordinates.
+  */
+  static void AddAffinePoint(const EcPoint<FieldElementT>& point, ProjectivePoint* sum);
+
+  std::shared_ptr<WindowTables> window_tables_;
 };
 
 /*
@@ -88,4 +135,6 @@ const PedersenHashContext<PrimeFieldElement<252, 0>>& GetStandardPedersenHashCon
 
 }  // namespace starkware
 
+#include "starkware/crypt_tools/hash_context/pedersen_hash_context.inl"
+
 #endif  // STARKWARE_CRYPT_TOOLS_HASH_CONTEXT_PEDERSEN_HASH_CONTEXT_H_
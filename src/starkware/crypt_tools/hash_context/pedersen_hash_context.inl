@@ -0,0 +1,159 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#include "starkware/crypt_tools/hash_context/pedersen_hash_context.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "starkware/algebra/field_operations.h"
+#include "starkware/utils/task_manager.h"
+
+namespace starkware {
+
+template <typename FieldElementT>
+void PedersenHashContext<FieldElementT>::HashPairs(
+    gsl::span<const FieldElementT> inputs, gsl::span<FieldElementT> outputs) const {
+  ASSERT_RELEASE(n_inputs == 2, "HashPairs() requires a context of two inputs.");
+  ASSERT_RELEASE(inputs.size() == 2 * outputs.size(), "Wrong number of inputs.");
+  // The number of hashes that share an inversion.
+  constexpr size_t kChunkSize = 256;
+  // Compute the tables before the parallel part.
+  GetWindowTables();
+
+  TaskManager::GetInstance().ParallelFor(
+      DivCeil(outputs.size(), kChunkSize), [&](const TaskInfo& task_info) {
+        const size_t begin = task_info.start_idx * kChunkSize;
+        const size_t end = std::min(begin + kChunkSize, outputs.size());
+        std::vector<FieldElementT> x_values;
+        std::vector<FieldElementT> z_values;
+        x_values.reserve(end - begin);
+        z_values.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+          const ProjectivePoint sum = HashProjective(inputs.subspan(2 * i, 2));
+          x_values.push_back(sum.x);
+          z_values.push_back(sum.z);
+        }
+        std::vector<FieldElementT> z_inverses = FieldElementT::UninitializedVector(end - begin);
+        BatchInverse<FieldElementT>(z_values, z_inverses);
+        for (size_t i = begin; i < end; ++i) {
+          outputs[i] = x_values[i - begin] * z_inverses[i - begin];
+        }
+      });
+}
+
+template <typename FieldElementT>
+auto PedersenHashContext<FieldElementT>::GetWindowTables() const
+    -> const std::vector<EcPoint<FieldElementT>>& {
+  std::call_once(window_tables_->once, [&]() { window_tables_->points = ComputeWindowTables(); });
+  return window_tables_->points;
+}
+
+template <typename FieldElementT>
+auto PedersenHashContext<FieldElementT>::ComputeWindowTables() const
+    -> std::vector<EcPoint<FieldElementT>> {
+  constexpr size_t kTableSize = Pow2(kWindowBits);
+  const size_t n_windows_per_input = NumWindowsPerInput();
+  // Entry 0 of each table (the empty sum) is never used.
+  std::vector<EcPoint<FieldElementT>> tables(
+      n_inputs * n_windows_per_input * kTableSize, shift_point);
+
+  // The entries in [2^bit, 2^(bit+1)) of each table are the point of that bit, plus the entries in
+  // [0, 2^bit). The additions of each bit are independent, so they share a single inversion.
+  for (size_t bit = 0; bit < kWindowBits; ++bit) {
+    // Pairs of (table entry, point to add to it).
+    std::vector<std::pair<size_t, const EcPoint<FieldElementT>*>> additions;
+    for (size_t window = 0; window < n_inputs * n_windows_per_input; ++window) {
+      const size_t input = window / n_windows_per_input;
+      const size_t bit_in_input = (window % n_windows_per_input) * kWindowBits + bit;
+      if (bit_in_input >= n_element_bits) {
+        continue;
+      }
+      const EcPoint<FieldElementT>& point = points[input * n_element_bits + bit_in_input];
+      tables[window * kTableSize + Pow2(bit)] = point;
+      for (size_t entry = 1; entry < Pow2(bit); ++entry) {
+        additions.emplace_back(window * kTableSize + entry, &point);
+      }
+    }
+
+    if (additions.empty()) {
+      continue;
+    }
+    std::vector<FieldElementT> x_diffs;
+    x_diffs.reserve(additions.size());
+    for (const auto& [entry, point] : additions) {
+      ASSERT_RELEASE(
+          tables[entry].x != point->x, "Adding a point to itself or to its inverse point.");
+      x_diffs.push_back(point->x - tables[entry].x);
+    }
+    std::vector<FieldElementT> x_diff_inverses = FieldElementT::UninitializedVector(x_diffs.size());
+    BatchInverse<FieldElementT>(x_diffs, x_diff_inverses);
+    for (size_t i = 0; i < additions.size(); ++i) {
+      const auto& [entry, point] = additions[i];
+      const FieldElementT slope = (point->y - tables[entry].y) * x_diff_inverses[i];
+      tables[entry + Pow2(bit)] = AddPointsGivenSlope(tables[entry], *point, slope);
+    }
+  }
+  return tables;
+}
+
+template <typename FieldElementT>
+auto PedersenHashContext<FieldElementT>::HashProjective(
+    gsl::span<const FieldElementT> hash_inputs) const -> ProjectivePoint {
+  ASSERT_RELEASE(
+      points.size() == n_element_bits * hash_inputs.size(),
+      "The number of points is not equal to the number of bits in total in the hash input.");
+  constexpr size_t kTableSize = Pow2(kWindowBits);
+  constexpr size_t kLimbBits = 64;
+  static_assert(kLimbBits % kWindowBits == 0, "A window must not cross limbs.");
+  const std::vector<EcPoint<FieldElementT>>& tables = GetWindowTables();
+  const size_t n_windows_per_input = NumWindowsPerInput();
+
+  ProjectivePoint sum{shift_point.x, shift_point.y, FieldElementT::One()};
+  for (size_t input = 0; input < hash_inputs.size(); ++input) {
+    const auto selector = hash_inputs[input].ToStandardForm();
+    ASSERT_RELEASE(
+        selector == selector.Zero() || selector.Log2Floor() < n_element_bits,
+        "Given selector is too big.");
+    for (size_t window = 0; window < n_windows_per_input; ++window) {
+      const size_t first_bit = window * kWindowBits;
+      const uint64_t value = (selector[first_bit / kLimbBits] >> (first_bit % kLimbBits)) &
+                             (kTableSize - 1);
+      if (value != 0) {
+        AddAffinePoint(
+            tables[(input * n_windows_per_input + window) * kTableSize + value], &sum);
+      }
+    }
+  }
+  return sum;
+}
+
+template <typename FieldElementT>
+void PedersenHashContext<FieldElementT>::AddAffinePoint(
+    const EcPoint<FieldElementT>& point, ProjectivePoint* sum) {
+  // The slope of the line through the points is u / v.
+  const FieldElementT u = point.y * sum->z - sum->y;
+  const FieldElementT v = point.x * sum->z - sum->x;
+  ASSERT_RELEASE(v != FieldElementT::Zero(), "Adding a point to itself or to its inverse point.");
+  const FieldElementT v_squared = v * v;
+  const FieldElementT v_cubed = v * v_squared;
+  const FieldElementT r = v_squared * sum->x;
+  const FieldElementT a = u * u * sum->z - v_cubed - r - r;
+  sum->y = u * (r - a) - v_cubed * sum->y;
+  sum->x = v * a;
+  sum->z = v_cubed * sum->z;
+}
+
+}  // namespace starkware
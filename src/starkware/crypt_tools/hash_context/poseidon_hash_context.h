@@ -0,0 +1,119 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#ifndef STARKWARE_CRYPT_TOOLS_HASH_CONTEXT_POSEIDON_HASH_CONTEXT_H_
+#define STARKWARE_CRYPT_TOOLS_HASH_CONTEXT_POSEIDON_HASH_CONTEXT_H_
+
+#include <array>
+#include <vector>
+
+#include "starkware/crypt_tools/hash_context/hash_context.h"
+
+#include "starkware/algebra/fields/prime_field_element.h"
+#include "starkware/error_handling/error_handling.h"
+
+namespace starkware {
+
+/*
+  A struct representing the configuration for the Poseidon (Hades) permutation over a state of 3
+  field elements, as used by the Poseidon builtin. This way we can define the hash functionality as
+  a standalone construct.
+      n_full_rounds - stores the number of full rounds, half of which are applied before the
+        partial rounds and half after them.
+      n_partial_rounds - stores the number of partial rounds.
+      round_keys - stores the constants added to the state at the beginning of each round.
+  The MDS matrix is fixed to ((3, 1, 1), (1, -1, 1), (1, 1, -2)), so that the linear layer costs
+  only a few additions.
+*/
+template <typename FieldElementT>
+struct PoseidonHashContext : public HashContext<FieldElementT> {
+  static constexpr size_t kStateSize = 3;
+  using State = std::array<FieldElementT, kStateSize>;
+
+  size_t n_full_rounds;
+  size_t n_partial_rounds;
+  std::vector<State> round_keys;
+
+  PoseidonHashContext(
+      size_t n_full_rounds, size_t n_partial_rounds, const std::vector<State>& round_keys)
+      : n_full_rounds(n_full_rounds), n_partial_rounds(n_partial_rounds), round_keys(round_keys) {
+    ASSERT_RELEASE(n_full_rounds % 2 == 0, "The number of full rounds must be even.");
+    ASSERT_RELEASE(
+        round_keys.size() == n_full_rounds + n_partial_rounds,
+        "round_keys should be of length n_full_rounds + n_partial_rounds.");
+  }
+
+  /*
+    Applies the Hades permutation to state in place.
+  */
+  void Permute(State* state) const {
+    State& s = *state;
+    size_t round = 0;
+    const auto full_round = [&]() {
+      for (size_t i = 0; i < kStateSize; ++i) {
+        s[i] += round_keys[round][i];
+        s[i] *= s[i] * s[i];
+      }
+      Mix(state);
+      ++round;
+    };
+
+    for (size_t i = 0; i < n_full_rounds / 2; ++i) {
+      full_round();
+    }
+    for (size_t i = 0; i < n_partial_rounds; ++i) {
+      for (size_t j = 0; j < kStateSize; ++j) {
+        s[j] += round_keys[round][j];
+      }
+      s[kStateSize - 1] *= s[kStateSize - 1] * s[kStateSize - 1];
+      Mix(state);
+      ++round;
+    }
+    for (size_t i = 0; i < n_full_rounds / 2; ++i) {
+      full_round();
+    }
+  }
+
+  /*
+    Defines the hash function used on pairs of field elements (poseidon_hash in Cairo):
+    the first element of Permute((x, y, 2)).
+  */
+  FieldElementT Hash(const FieldElementT& x, const FieldElementT& y) const override {
+    State state{x, y, FieldElementT::FromUint(2)};
+    Permute(&state);
+    return state[0];
+  }
+
+ private:
+  /*
+    Multiplies state by the MDS matrix.
+  */
+  static void Mix(State* state) {
+    State& s = *state;
+    const FieldElementT sum = s[0] + s[1] + s[2];
+    s[0] = sum + s[0] + s[0];
+    s[1] = sum - s[1] - s[1];
+    s[2] = sum - s[2] - s[2] - s[2];
+  }
+};
+
+/*
+  Returns the standard PoseidonHashContext, using the round keys of the Poseidon builtin.
+*/
+const PoseidonHashContext<PrimeFieldElement<252, 0>>& GetStandardPoseidonHashContext();
+
+}  // namespace starkware
+
+#endif  // STARKWARE_CRYPT_TOOLS_HASH_CONTEXT_POSEIDON_HASH_CONTEXT_H_
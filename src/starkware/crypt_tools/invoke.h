@@ -25,13 +25,14 @@
 #include "starkware/crypt_tools/keccak_256.h"
 #include "starkware/crypt_tools/masked_hash.h"
 #include "starkware/crypt_tools/pedersen.h"
+#include "starkware/crypt_tools/poseidon.h"
 
 namespace starkware {
 
 using HashTypes = InvokedTypes<
     Blake2s256, Keccak256, Pedersen, MaskedHash<Keccak256, 20, true>,
     MaskedHash<Blake2s256, 20, true>, MaskedHash<Blake2s256, 20, false>,
-    MaskedHash<Keccak256, 20, false>>;
+    MaskedHash<Keccak256, 20, false>, Poseidon3>;
 
 template <typename Func>
 auto InvokeByHashFunc(const std::string& hash_name, const Func& func) {
@@ -48,6 +48,14 @@ class Keccak256 {
   static Keccak256 HashBytesWithLength(
       gsl::span<const std::byte> bytes, const Keccak256& initial_hash);
 
+  /*
+    Hashes outputs.size() messages of message_size bytes each, which are given one after the other
+    in bytes. Groups of messages are hashed together using a multi-buffer Keccak permutation (see
+    multi_buffer/keccak_f1600.h).
+  */
+  static void HashBytesWithLengthBatch(
+      gsl::span<const std::byte> bytes, size_t message_size, gsl::span<Keccak256> outputs);
+
   bool operator==(const Keccak256& other) const;
   bool operator!=(const Keccak256& other) const;
   const std::array<std::byte, kDigestNumBytes>& GetDigest() const { return buffer_; }
@@ -14,6 +14,7 @@
 
 #include "starkware/crypt_tools/keccak_256.h"
 
+#include "starkware/crypt_tools/multi_buffer/keccak_f1600.h"
 #include "starkware/crypt_tools/utils.h"
 #include "starkware/error_handling/error_handling.h"
 #include "starkware/stl_utils/containers.h"
@@ -160,6 +161,51 @@ inline Keccak256 Keccak256::HashBytesWithLength(gsl::span<const std::byte> bytes
   return state.ExtractState();
 }
 
+inline void Keccak256::HashBytesWithLengthBatch(
+    gsl::span<const std::byte> bytes, size_t message_size, gsl::span<Keccak256> outputs) {
+  ASSERT_RELEASE(bytes.size() == message_size * outputs.size(), "Wrong input size.");
+  constexpr size_t kBlockBytes = keccak_state::kBlockBytes;
+  constexpr size_t kBatchSize = 8;
+
+  size_t first = 0;
+  for (; first + kBatchSize <= outputs.size(); first += kBatchSize) {
+    std::array<multi_buffer::KeccakState, kBatchSize> states{};
+    const auto xor_with_states = [&](size_t offset, size_t n_bytes) {
+      for (size_t i = 0; i < kBatchSize; ++i) {
+        auto* state_bytes = reinterpret_cast<std::byte*>(states[i].data());
+        const std::byte* message = bytes.data() + (first + i) * message_size + offset;
+        for (size_t j = 0; j < n_bytes; ++j) {
+          state_bytes[j] ^= message[j];
+        }
+      }
+    };
+
+    // Absorb the full blocks, then the last partial (or empty) block with its padding.
+    size_t offset = 0;
+    for (; offset + kBlockBytes <= message_size; offset += kBlockBytes) {
+      xor_with_states(offset, kBlockBytes);
+      multi_buffer::KeccakF1600PermuteStates(states);
+    }
+    xor_with_states(offset, message_size - offset);
+    for (auto& state : states) {
+      auto* state_bytes = reinterpret_cast<std::byte*>(state.data());
+      state_bytes[message_size - offset] ^= std::byte(0x1);
+      state_bytes[kBlockBytes - 1] ^= std::byte(0x80);
+    }
+    multi_buffer::KeccakF1600PermuteStates(states);
+
+    for (size_t i = 0; i < kBatchSize; ++i) {
+      outputs[first + i] =
+          InitDigestTo(gsl::make_span(states[i]).as_span<std::byte>().first(kDigestNumBytes));
+    }
+  }
+
+  // Hash the remaining messages one by one.
+  for (; first < outputs.size(); ++first) {
+    outputs[first] = HashBytesWithLength(bytes.subspan(first * message_size, message_size));
+  }
+}
+
 inline std::array<std::byte, Keccak256::kStateNumBytes> Keccak256::ApplyPermutation(
     gsl::span<const std::byte> bytes) {
   keccak_state state;
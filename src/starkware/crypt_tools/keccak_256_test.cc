@@ -84,6 +84,23 @@ TEST(Keccak256, TestVectors) {
       Keccak256::HashBytesWithLength(GenerateTestVector(1000)));
 }
 
+TEST(Keccak256, HashBytesWithLengthBatch) {
+  // Message sizes around the block size (136 bytes) and numbers of messages that are not a multiple
+  // of the batch size.
+  for (const size_t message_size : {0, 7, 64, 135, 136, 137, 300}) {
+    for (const size_t n_messages : {1, 8, 19}) {
+      const std::vector<std::byte> bytes = GenerateTestVector(message_size * n_messages);
+      std::vector<Keccak256> outputs(n_messages);
+      Keccak256::HashBytesWithLengthBatch(bytes, message_size, outputs);
+      for (size_t i = 0; i < n_messages; ++i) {
+        EXPECT_EQ(
+            outputs[i], Keccak256::HashBytesWithLength(
+                            gsl::make_span(bytes).subspan(i * message_size, message_size)));
+      }
+    }
+  }
+}
+
 }  // namespace
 
 }  // namespace starkware
@@ -20,9 +20,11 @@
 #include <cstring>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "third_party/gsl/gsl-lite.hpp"
 
+#include "starkware/crypt_tools/batch_hash.h"
 #include "starkware/crypt_tools/utils.h"
 #include "starkware/error_handling/error_handling.h"
 #include "starkware/utils/to_from_string.h"
@@ -66,6 +68,19 @@ class MaskedHash {
     return MaskHash(HashT::HashBytesWithLength(bytes));
   }
 
+  /*
+    Same as HashBytesWithLength() for several messages of message_size bytes each, which are given
+    one after the other in bytes. Uses the multi-buffer implementation of HashT if it has one.
+  */
+  static void HashBytesWithLengthBatch(
+      gsl::span<const std::byte> bytes, size_t message_size, gsl::span<MaskedHash> outputs) {
+    std::vector<HashT> hashes(outputs.size());
+    starkware::HashBytesWithLengthBatch<HashT>(bytes, message_size, hashes);
+    for (size_t i = 0; i < outputs.size(); ++i) {
+      outputs[i] = MaskHash(hashes[i]);
+    }
+  }
+
   static MaskedHash HashBytesWithLength(
       gsl::span<const std::byte> bytes, const MaskedHash& initial_hash) {
     return MaskHash(
@@ -23,6 +23,7 @@
 #include "third_party/gsl/gsl-lite.hpp"
 
 #include "starkware/algebra/big_int.h"
+#include "starkware/crypt_tools/batch_hash.h"
 #include "starkware/crypt_tools/blake2s.h"
 #include "starkware/crypt_tools/keccak_256.h"
 #include "starkware/utils/serialization.h"
@@ -119,6 +120,20 @@ TYPED_TEST(MaskedHashTest, TestVectors) {
       TypeParam::HashBytesWithLength(GenerateTestVector(1000)));
 }
 
+TYPED_TEST(MaskedHashTest, HashPairsBatch) {
+  const std::vector<std::byte> bytes = GenerateTestVector(TypeParam::kDigestNumBytes * 22);
+  std::vector<TypeParam> nodes;
+  for (size_t i = 0; i < 22; ++i) {
+    nodes.push_back(TypeParam::HashBytesWithLength(
+        gsl::make_span(bytes).subspan(i * TypeParam::kDigestNumBytes, TypeParam::kDigestNumBytes)));
+  }
+  std::vector<TypeParam> outputs(11);
+  HashPairsBatch<TypeParam>(nodes, outputs);
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    EXPECT_EQ(outputs[i], TypeParam::Hash(nodes[2 * i], nodes[2 * i + 1]));
+  }
+}
+
 TYPED_TEST(MaskedHashTest, HashName) {
   using HashMsb = MaskedHash<Keccak256, 20, true>;
   EXPECT_EQ(HashMsb::HashName(), "keccak256_masked160_msb");
@@ -0,0 +1,44 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#ifndef STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_BLAKE2S_TIMES8_H_
+#define STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_BLAKE2S_TIMES8_H_
+
+#include <cstddef>
+
+#include "third_party/gsl/gsl-lite.hpp"
+
+namespace starkware {
+namespace multi_buffer {
+
+#ifndef NO_AVX
+
+/*
+  Computes the (unkeyed) Blake2s hashes of 8 messages of message_size bytes each, which are given
+  one after the other in bytes. The hashes, of digest_num_bytes bytes each, are written one after
+  the other to outputs.
+  The 8 messages are hashed together using AVX2, where each of the 32-bit words of the Blake2s state
+  is kept in a SIMD register holding that word for all the messages.
+*/
+void Blake2sTimes8(
+    gsl::span<const std::byte> bytes, size_t message_size, size_t digest_num_bytes,
+    gsl::span<std::byte> outputs);
+
+#endif
+
+}  // namespace multi_buffer
+}  // namespace starkware
+
+#endif  // STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_BLAKE2S_TIMES8_H_
@@ -0,0 +1,186 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+/*
+  8-way Blake2s using AVX2. This file is compiled with -mavx2.
+*/
+
+#include "starkware/crypt_tools/multi_buffer/blake2s_times8.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "starkware/error_handling/error_handling.h"
+
+namespace starkware {
+namespace multi_buffer {
+
+namespace {
+
+constexpr size_t kNumMessages = 8;
+constexpr size_t kBlockNumBytes = 64;
+constexpr size_t kBlockNumWords = kBlockNumBytes / sizeof(uint32_t);
+constexpr size_t kMaxDigestNumBytes = 32;
+
+constexpr std::array<uint32_t, 8> kIv = {0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+                                         0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+
+constexpr std::array<std::array<uint8_t, 16>, 10> kSigma = {{
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+}};
+
+inline __m256i Add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+inline __m256i Xor(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+
+inline __m256i Rotr16(__m256i a) {
+  const __m256i shuffle = _mm256_set_epi8(
+      13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2, 13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6,
+      1, 0, 3, 2);
+  return _mm256_shuffle_epi8(a, shuffle);
+}
+
+inline __m256i Rotr8(__m256i a) {
+  const __m256i shuffle = _mm256_set_epi8(
+      12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1, 12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5,
+      0, 3, 2, 1);
+  return _mm256_shuffle_epi8(a, shuffle);
+}
+
+inline __m256i Rotr12(__m256i a) {
+  return _mm256_or_si256(_mm256_srli_epi32(a, 12), _mm256_slli_epi32(a, 20));
+}
+
+inline __m256i Rotr7(__m256i a) {
+  return _mm256_or_si256(_mm256_srli_epi32(a, 7), _mm256_slli_epi32(a, 25));
+}
+
+/*
+  The G mixing function of Blake2s, applied to the columns (a, b, c, d) of the state.
+*/
+inline void G(
+    __m256i* a, __m256i* b, __m256i* c, __m256i* d, const __m256i& message_word0,
+    const __m256i& message_word1) {
+  *a = Add(Add(*a, *b), message_word0);
+  *d = Rotr16(Xor(*d, *a));
+  *c = Add(*c, *d);
+  *b = Rotr12(Xor(*b, *c));
+  *a = Add(Add(*a, *b), message_word1);
+  *d = Rotr8(Xor(*d, *a));
+  *c = Add(*c, *d);
+  *b = Rotr7(Xor(*b, *c));
+}
+
+/*
+  Compresses one block of each of the 8 messages into the state h[0], ..., h[7]. m[i] holds word i
+  of the blocks. Plain arrays are used (rather than std::array) since SIMD types lose their
+  attributes when used as template arguments.
+*/
+void Compress(__m256i* h, const __m256i* m, uint64_t counter, bool is_last_block) {
+  __m256i v[16];  // NOLINT
+  for (size_t i = 0; i < 8; ++i) {
+    v[i] = h[i];
+    v[i + 8] = _mm256_set1_epi32(kIv[i]);
+  }
+  v[12] = Xor(v[12], _mm256_set1_epi32(static_cast<uint32_t>(counter)));
+  v[13] = Xor(v[13], _mm256_set1_epi32(static_cast<uint32_t>(counter >> 32)));
+  if (is_last_block) {
+    v[14] = Xor(v[14], _mm256_set1_epi32(-1));
+  }
+
+  for (const auto& s : kSigma) {
+    // Columns.
+    G(&v[0], &v[4], &v[8], &v[12], m[s[0]], m[s[1]]);
+    G(&v[1], &v[5], &v[9], &v[13], m[s[2]], m[s[3]]);
+    G(&v[2], &v[6], &v[10], &v[14], m[s[4]], m[s[5]]);
+    G(&v[3], &v[7], &v[11], &v[15], m[s[6]], m[s[7]]);
+    // Diagonals.
+    G(&v[0], &v[5], &v[10], &v[15], m[s[8]], m[s[9]]);
+    G(&v[1], &v[6], &v[11], &v[12], m[s[10]], m[s[11]]);
+    G(&v[2], &v[7], &v[8], &v[13], m[s[12]], m[s[13]]);
+    G(&v[3], &v[4], &v[9], &v[14], m[s[14]], m[s[15]]);
+  }
+
+  for (size_t i = 0; i < 8; ++i) {
+    h[i] = Xor(h[i], Xor(v[i], v[i + 8]));
+  }
+}
+
+}  // namespace
+
+void Blake2sTimes8(
+    gsl::span<const std::byte> bytes, size_t message_size, size_t digest_num_bytes,
+    gsl::span<std::byte> outputs) {
+  ASSERT_RELEASE(bytes.size() == kNumMessages * message_size, "Wrong input size.");
+  ASSERT_RELEASE(
+      digest_num_bytes > 0 && digest_num_bytes <= kMaxDigestNumBytes, "Wrong digest size.");
+  ASSERT_RELEASE(outputs.size() == kNumMessages * digest_num_bytes, "Wrong output size.");
+
+  // Initialize the state with the parameter block: digest length, no key, fanout 1 and depth 1.
+  __m256i h[8];  // NOLINT
+  for (size_t i = 0; i < 8; ++i) {
+    h[i] = _mm256_set1_epi32(kIv[i]);
+  }
+  h[0] = Xor(h[0], _mm256_set1_epi32(0x01010000 ^ static_cast<uint32_t>(digest_num_bytes)));
+
+  // Every message is compressed in at least one block. The last block is zero padded, and the
+  // counter holds the number of message bytes compressed so far.
+  const size_t n_blocks = std::max<size_t>((message_size + kBlockNumBytes - 1) / kBlockNumBytes, 1);
+  alignas(32) std::array<std::array<uint32_t, kNumMessages>, kBlockNumWords> words;  // NOLINT
+  __m256i m[kBlockNumWords];  // NOLINT
+  for (size_t block = 0; block < n_blocks; ++block) {
+    const size_t block_start = block * kBlockNumBytes;
+    const size_t block_size = std::min(kBlockNumBytes, message_size - block_start);
+    for (size_t msg = 0; msg < kNumMessages; ++msg) {
+      std::array<uint32_t, kBlockNumWords> block_words{};
+      memcpy(block_words.data(), bytes.data() + msg * message_size + block_start, block_size);
+      for (size_t i = 0; i < kBlockNumWords; ++i) {
+        words[i][msg] = block_words[i];
+      }
+    }
+    for (size_t i = 0; i < kBlockNumWords; ++i) {
+      m[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(words[i].data()));
+    }
+    Compress(h, m, block_start + block_size, block == n_blocks - 1);
+  }
+
+  // Transpose the state back and output the (little endian) digests.
+  alignas(32) std::array<std::array<uint32_t, kNumMessages>, 8> h_words;  // NOLINT
+  for (size_t i = 0; i < 8; ++i) {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(h_words[i].data()), h[i]);
+  }
+  for (size_t msg = 0; msg < kNumMessages; ++msg) {
+    std::array<uint32_t, 8> digest_words;  // NOLINT
+    for (size_t i = 0; i < 8; ++i) {
+      digest_words[i] = h_words[i][msg];
+    }
+    memcpy(&outputs[msg * digest_num_bytes], digest_words.data(), digest_num_bytes);
+  }
+}
+
+}  // namespace multi_buffer
+}  // namespace starkware
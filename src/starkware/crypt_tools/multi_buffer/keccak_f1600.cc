@@ -0,0 +1,68 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#include "starkware/crypt_tools/multi_buffer/keccak_f1600.h"
+
+#include "starkware/crypt_tools/multi_buffer/keccak_f1600_rounds.h"
+
+namespace starkware {
+namespace multi_buffer {
+
+namespace details {
+
+namespace {
+
+struct Uint64LaneOps {
+  using Lane = uint64_t;
+  static Lane Xor(Lane a, Lane b) { return a ^ b; }
+  static Lane AndNot(Lane a, Lane b) { return ~a & b; }
+  static Lane Rotl(Lane a, int n) { return (a << n) | (a >> (64 - n)); }
+  static Lane Broadcast(uint64_t value) { return value; }
+};
+
+#ifndef NO_AVX
+bool CpuSupportsAvx512() {
+  static const bool kSupportsAvx512 = __builtin_cpu_supports("avx512f") != 0;
+  return kSupportsAvx512;
+}
+#endif
+
+}  // namespace
+
+void KeccakF1600Permute(KeccakState* state) { KeccakF1600Rounds<Uint64LaneOps>(state->data()); }
+
+}  // namespace details
+
+void KeccakF1600PermuteStates(gsl::span<KeccakState> states) {
+  size_t i = 0;
+#ifndef NO_AVX
+  // As in Keccak256, AVX2 is assumed to be available unless NO_AVX is defined. AVX-512 is checked
+  // at runtime.
+  if (details::CpuSupportsAvx512()) {
+    for (; i + 8 <= states.size(); i += 8) {
+      details::KeccakF1600PermuteTimes8Avx512(&states[i]);
+    }
+  }
+  for (; i + 4 <= states.size(); i += 4) {
+    details::KeccakF1600PermuteTimes4Avx2(&states[i]);
+  }
+#endif
+  for (; i < states.size(); ++i) {
+    details::KeccakF1600Permute(&states[i]);
+  }
+}
+
+}  // namespace multi_buffer
+}  // namespace starkware
@@ -0,0 +1,60 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#ifndef STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_KECCAK_F1600_H_
+#define STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_KECCAK_F1600_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "third_party/gsl/gsl-lite.hpp"
+
+namespace starkware {
+namespace multi_buffer {
+
+/*
+  The 1600-bit state of Keccak, as 25 lanes of 64 bits. Lane (x, y) is at index x + 5 * y, and the
+  bytes of the state are the little endian bytes of the lanes (the standard byte order of Keccak).
+*/
+using KeccakState = std::array<uint64_t, 25>;
+
+/*
+  Applies the Keccak-f[1600] permutation (24 rounds) to each of the given independent states.
+  The states are permuted in groups of 8 (AVX-512) or 4 (AVX2) using SIMD lanes, when the CPU
+  supports it, so that hashing independent messages together is several times faster than hashing
+  them one by one.
+*/
+void KeccakF1600PermuteStates(gsl::span<KeccakState> states);
+
+namespace details {
+
+/*
+  Single buffer and multi buffer implementations used by KeccakF1600PermuteStates(). The
+  multi-buffer ones permute exactly 4 or 8 consecutive states.
+*/
+void KeccakF1600Permute(KeccakState* state);
+
+#ifndef NO_AVX
+void KeccakF1600PermuteTimes4Avx2(KeccakState* states);
+void KeccakF1600PermuteTimes8Avx512(KeccakState* states);
+#endif
+
+}  // namespace details
+
+}  // namespace multi_buffer
+}  // namespace starkware
+
+#endif  // STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_KECCAK_F1600_H_
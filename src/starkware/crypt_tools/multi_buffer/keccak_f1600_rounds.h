@@ -0,0 +1,107 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+/*
+  The rounds of Keccak-f[1600], written once for every lane type. Each translation unit that
+  includes this file instantiates KeccakF1600Rounds() with its own LaneOps (a 64-bit integer, or a
+  SIMD register holding the same lane of several states), so that the SIMD versions are compiled
+  with the instruction set flags of their own translation unit only.
+
+  LaneOps must define the type Lane and the static functions Xor(a, b), AndNot(a, b) (which
+  computes ~a & b), Rotl(a, n) and Broadcast(uint64_t).
+*/
+
+#ifndef STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_KECCAK_F1600_ROUNDS_H_
+#define STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_KECCAK_F1600_ROUNDS_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace starkware {
+namespace multi_buffer {
+namespace details {
+
+constexpr size_t kKeccakNumRounds = 24;
+
+constexpr std::array<uint64_t, kKeccakNumRounds> kKeccakRoundConstants = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+    0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+    0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+    0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008};
+
+/*
+  The rho rotation offsets and the pi lane permutation, in the order in which the lanes are visited
+  when following the pi cycle starting at lane 1.
+*/
+constexpr std::array<int, 24> kKeccakRhoOffsets = {1,  3,  6,  10, 15, 21, 28, 36, 45, 55, 2,  14,
+                                                   27, 41, 56, 8,  25, 43, 62, 18, 39, 61, 20, 44};
+constexpr std::array<size_t, 24> kKeccakPiLanes = {10, 7,  11, 17, 18, 3, 5,  16, 8,  21, 24, 4,
+                                                   15, 23, 19, 13, 12, 2, 20, 14, 22, 9,  6,  1};
+
+/*
+  Applies the rounds to the 25 lanes a[0], ..., a[24]. Plain arrays are used (rather than
+  std::array) since SIMD types lose their attributes when used as template arguments.
+*/
+template <typename LaneOps>
+inline void KeccakF1600Rounds(typename LaneOps::Lane* a) {
+  using Lane = typename LaneOps::Lane;
+  Lane c[5];  // NOLINT
+
+  for (size_t round = 0; round < kKeccakNumRounds; ++round) {
+    // Theta.
+    for (size_t x = 0; x < 5; ++x) {
+      c[x] = LaneOps::Xor(
+          LaneOps::Xor(LaneOps::Xor(a[x], a[x + 5]), LaneOps::Xor(a[x + 10], a[x + 15])),
+          a[x + 20]);
+    }
+    for (size_t x = 0; x < 5; ++x) {
+      const Lane d = LaneOps::Xor(c[(x + 4) % 5], LaneOps::Rotl(c[(x + 1) % 5], 1));
+      for (size_t y = 0; y < 25; y += 5) {
+        a[x + y] = LaneOps::Xor(a[x + y], d);
+      }
+    }
+
+    // Rho and pi.
+    Lane current = a[1];
+    for (size_t i = 0; i < 24; ++i) {
+      const size_t lane = kKeccakPiLanes[i];
+      const Lane next = a[lane];
+      a[lane] = LaneOps::Rotl(current, kKeccakRhoOffsets[i]);
+      current = next;
+    }
+
+    // Chi.
+    for (size_t y = 0; y < 25; y += 5) {
+      for (size_t x = 0; x < 5; ++x) {
+        c[x] = a[x + y];
+      }
+      for (size_t x = 0; x < 5; ++x) {
+        a[x + y] = LaneOps::Xor(c[x], LaneOps::AndNot(c[(x + 1) % 5], c[(x + 2) % 5]));
+      }
+    }
+
+    // Iota.
+    a[0] = LaneOps::Xor(a[0], LaneOps::Broadcast(kKeccakRoundConstants[round]));
+  }
+}
+
+}  // namespace details
+}  // namespace multi_buffer
+}  // namespace starkware
+
+#endif  // STARKWARE_CRYPT_TOOLS_MULTI_BUFFER_KECCAK_F1600_ROUNDS_H_
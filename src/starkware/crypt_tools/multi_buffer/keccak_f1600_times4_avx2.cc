@@ -0,0 +1,64 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+/*
+  4-way Keccak-f[1600] using AVX2. This file is compiled with -mavx2.
+*/
+
+#include <immintrin.h>
+
+#include "starkware/crypt_tools/multi_buffer/keccak_f1600.h"
+#include "starkware/crypt_tools/multi_buffer/keccak_f1600_rounds.h"
+
+namespace starkware {
+namespace multi_buffer {
+namespace details {
+
+namespace {
+
+struct Avx2LaneOps {
+  using Lane = __m256i;
+  static Lane Xor(Lane a, Lane b) { return _mm256_xor_si256(a, b); }
+  static Lane AndNot(Lane a, Lane b) { return _mm256_andnot_si256(a, b); }
+  static Lane Rotl(Lane a, int n) {
+    return _mm256_or_si256(
+        _mm256_sll_epi64(a, _mm_cvtsi32_si128(n)), _mm256_srl_epi64(a, _mm_cvtsi32_si128(64 - n)));
+  }
+  static Lane Broadcast(uint64_t value) { return _mm256_set1_epi64x(value); }
+};
+
+}  // namespace
+
+void KeccakF1600PermuteTimes4Avx2(KeccakState* states) {
+  // Transpose the states, so that lane i of all the states is in lanes[i].
+  __m256i lanes[25];  // NOLINT
+  for (size_t i = 0; i < 25; ++i) {
+    lanes[i] = _mm256_set_epi64x(states[3][i], states[2][i], states[1][i], states[0][i]);
+  }
+
+  KeccakF1600Rounds<Avx2LaneOps>(lanes);
+
+  alignas(32) std::array<uint64_t, 4> lane_values;  // NOLINT
+  for (size_t i = 0; i < 25; ++i) {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lane_values.data()), lanes[i]);
+    for (size_t j = 0; j < 4; ++j) {
+      states[j][i] = lane_values[j];
+    }
+  }
+}
+
+}  // namespace details
+}  // namespace multi_buffer
+}  // namespace starkware
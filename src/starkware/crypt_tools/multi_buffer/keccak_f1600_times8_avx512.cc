@@ -0,0 +1,71 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+/*
+  8-way Keccak-f[1600] using AVX-512. This file is compiled with -mavx512f, and its function is only
+  called after checking at runtime that the CPU supports AVX-512.
+*/
+
+#include <immintrin.h>
+
+#include "starkware/crypt_tools/multi_buffer/keccak_f1600.h"
+#include "starkware/crypt_tools/multi_buffer/keccak_f1600_rounds.h"
+
+namespace starkware {
+namespace multi_buffer {
+namespace details {
+
+namespace {
+
+/*
+  The zero-masked forms of andnot and rolv are used since the unmasked ones trigger a false
+  -Wuninitialized warning in some versions of GCC. They compile to the same instructions.
+*/
+struct Avx512LaneOps {
+  using Lane = __m512i;
+  static constexpr __mmask8 kAllLanes = 0xff;
+  static Lane Xor(Lane a, Lane b) { return _mm512_xor_si512(a, b); }
+  static Lane AndNot(Lane a, Lane b) { return _mm512_maskz_andnot_epi64(kAllLanes, a, b); }
+  static Lane Rotl(Lane a, int n) {
+    return _mm512_maskz_rolv_epi64(kAllLanes, a, _mm512_set1_epi64(n));
+  }
+  static Lane Broadcast(uint64_t value) { return _mm512_set1_epi64(value); }
+};
+
+}  // namespace
+
+void KeccakF1600PermuteTimes8Avx512(KeccakState* states) {
+  // Transpose the states, so that lane i of all the states is in lanes[i].
+  __m512i lanes[25];  // NOLINT
+  for (size_t i = 0; i < 25; ++i) {
+    lanes[i] = _mm512_set_epi64(
+        states[7][i], states[6][i], states[5][i], states[4][i], states[3][i], states[2][i],
+        states[1][i], states[0][i]);
+  }
+
+  KeccakF1600Rounds<Avx512LaneOps>(lanes);
+
+  alignas(64) std::array<uint64_t, 8> lane_values;  // NOLINT
+  for (size_t i = 0; i < 25; ++i) {
+    _mm512_store_si512(lane_values.data(), lanes[i]);
+    for (size_t j = 0; j < 8; ++j) {
+      states[j][i] = lane_values[j];
+    }
+  }
+}
+
+}  // namespace details
+}  // namespace multi_buffer
+}  // namespace starkware
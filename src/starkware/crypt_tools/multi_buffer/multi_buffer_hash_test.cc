@@ -0,0 +1,57 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#include "starkware/crypt_tools/multi_buffer/keccak_f1600.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "starkware/randomness/prng.h"
+
+namespace starkware {
+namespace multi_buffer {
+namespace {
+
+TEST(KeccakF1600, ZeroState) {
+  // The first lanes of Keccak-f[1600] applied to the zero state (from the Keccak test vectors).
+  KeccakState state{};
+  details::KeccakF1600Permute(&state);
+  EXPECT_EQ(state[0], 0xF1258F7940E1DDE7);
+  EXPECT_EQ(state[1], 0x84D5CCF933C0478A);
+  EXPECT_EQ(state[24], 0xEAF1FF7B5CECA249);
+}
+
+TEST(KeccakF1600, PermuteStatesMatchesSingleState) {
+  Prng prng;
+  for (const size_t n_states : {0, 1, 3, 4, 8, 13, 16}) {
+    std::vector<KeccakState> states(n_states);
+    for (auto& state : states) {
+      for (auto& lane : state) {
+        lane = prng.UniformInt<uint64_t>(0, std::numeric_limits<uint64_t>::max());
+      }
+    }
+    std::vector<KeccakState> expected = states;
+    for (auto& state : expected) {
+      details::KeccakF1600Permute(&state);
+    }
+    KeccakF1600PermuteStates(states);
+    EXPECT_EQ(states, expected);
+  }
+}
+
+}  // namespace
+}  // namespace multi_buffer
+}  // namespace starkware
@@ -43,6 +43,12 @@ class Pedersen {
 
   static Pedersen Hash(const Pedersen& val0, const Pedersen& val1);
 
+  /*
+    Computes outputs[i] = Hash(inputs[2 * i], inputs[2 * i + 1]) for all i, in parallel and with
+    shared field inversions. See PedersenHashContext::HashPairs().
+  */
+  static void HashPairsBatch(gsl::span<const Pedersen> inputs, gsl::span<Pedersen> outputs);
+
   static Pedersen HashBytesWithLength(gsl::span<const std::byte> bytes);
 
   static Pedersen HashBytesWithLength(
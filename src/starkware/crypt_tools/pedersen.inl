@@ -14,6 +14,8 @@
 
 #include "starkware/crypt_tools/pedersen.h"
 
+#include <vector>
+
 #include "starkware/crypt_tools/hash_context/pedersen_hash_context.h"
 #include "starkware/crypt_tools/utils.h"
 #include "starkware/error_handling/error_handling.h"
@@ -33,6 +35,20 @@ inline Pedersen Pedersen::Hash(const Pedersen& val0, const Pedersen& val1) {
   return Pedersen(res);
 }
 
+inline void Pedersen::HashPairsBatch(
+    gsl::span<const Pedersen> inputs, gsl::span<Pedersen> outputs) {
+  std::vector<FieldElementT> input_states;
+  input_states.reserve(inputs.size());
+  for (const Pedersen& input : inputs) {
+    input_states.push_back(input.state_);
+  }
+  std::vector<FieldElementT> output_states = FieldElementT::UninitializedVector(outputs.size());
+  GetStandardPedersenHashContext().HashPairs(input_states, output_states);
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    outputs[i] = Pedersen(output_states[i]);
+  }
+}
+
 inline Pedersen Pedersen::HashBytesWithLength(gsl::span<const std::byte> bytes) {
   return Pedersen::HashBytesWithLength(bytes, Pedersen(FieldElementT::Zero()));
 }
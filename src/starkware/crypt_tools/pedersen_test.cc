@@ -23,7 +23,9 @@
 #include "third_party/gsl/gsl-lite.hpp"
 
 #include "starkware/algebra/big_int.h"
+#include "starkware/crypt_tools/hash_context/pedersen_hash_context.h"
 #include "starkware/crypt_tools/test_utils.h"
+#include "starkware/randomness/prng.h"
 #include "starkware/utils/serialization.h"
 
 namespace starkware {
@@ -54,5 +56,43 @@ TEST(Pedersen, TestVectors) {
       Pedersen::HashBytesWithLength(GenerateTestVector(64)));
 }
 
+TEST(Pedersen, HashMatchesSubsetSum) {
+  Prng prng;
+  const auto& ctx = GetStandardPedersenHashContext();
+  const std::array<FieldElementT, 2> inputs = {
+      FieldElementT::RandomElement(&prng), FieldElementT::RandomElement(&prng)};
+
+  // Add the point of each set bit to the shift point, one by one.
+  EcPoint<FieldElementT> expected = ctx.shift_point;
+  for (size_t input = 0; input < inputs.size(); ++input) {
+    const std::vector<bool> bits = inputs[input].ToStandardForm().ToBoolVector();
+    for (size_t bit = 0; bit < ctx.n_element_bits; ++bit) {
+      if (bits[bit]) {
+        expected = expected + ctx.points[input * ctx.n_element_bits + bit];
+      }
+    }
+  }
+
+  EXPECT_EQ(expected.x, ctx.Hash(inputs[0], inputs[1]));
+  EXPECT_EQ(ctx.shift_point.x, ctx.Hash(FieldElementT::Zero(), FieldElementT::Zero()));
+}
+
+TEST(Pedersen, HashPairsBatch) {
+  Prng prng;
+  // More than a single chunk of hashes which share an inversion.
+  const size_t n_outputs = 1000;
+  std::vector<Pedersen> inputs;
+  inputs.reserve(2 * n_outputs);
+  for (size_t i = 0; i < 2 * n_outputs; ++i) {
+    inputs.push_back(AsDigest(FieldElementT::RandomElement(&prng).ToStandardForm()));
+  }
+
+  std::vector<Pedersen> outputs(n_outputs);
+  Pedersen::HashPairsBatch(inputs, outputs);
+  for (size_t i = 0; i < n_outputs; ++i) {
+    ASSERT_EQ(Pedersen::Hash(inputs[2 * i], inputs[2 * i + 1]), outputs[i]);
+  }
+}
+
 }  // namespace
 }  // namespace starkware
@@ -0,0 +1,97 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#ifndef STARKWARE_CRYPT_TOOLS_POSEIDON_H_
+#define STARKWARE_CRYPT_TOOLS_POSEIDON_H_
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "starkware/algebra/fields/prime_field_element.h"
+
+#include "third_party/gsl/gsl-lite.hpp"
+
+namespace starkware {
+
+/*
+  A hash over the Stark field, based on the Hades permutation of the Poseidon builtin (see
+  PoseidonHashContext). Unlike Pedersen, each hash costs a few hundred field multiplications, so it
+  is cheap both for the prover and for a verifier written in Cairo.
+  Hash(x, y) is poseidon_hash(x, y) of Cairo. HashBytesWithLength() is a sponge with rate 2, whose
+  exact format is documented below.
+*/
+class Poseidon3 {
+ public:
+  using FieldElementT = PrimeFieldElement<252, 0>;
+  using ValueType = FieldElementT::ValueType;
+
+  static constexpr size_t kDigestNumBytes = SafeDiv(256, 8);
+  static std::string HashName() { return "poseidon3"; }
+
+  Poseidon3() : state_(FieldElementT::Uninitialized()) {}  // NOLINT
+
+  static Poseidon3 InitDigestTo(const gsl::span<const std::byte>& digest);
+
+  static Poseidon3 Hash(const Poseidon3& val0, const Poseidon3& val1);
+
+  static Poseidon3 HashBytesWithLength(gsl::span<const std::byte> bytes);
+
+  /*
+    A sponge over the Hades permutation, with a state (s0, s1, s2) of rate 2 (s0, s1) and capacity
+    1 (s2). The absorbed sequence of field elements e_0, e_1, ..., e_{2k-1} is:
+      1. initial_hash.
+      2. The words of bytes: bytes is split into kDigestNumBytes-byte big-endian words, the last of
+         which is padded with zero bytes on the right. A word w is absorbed as w mod p, where p is
+         the field prime, and its quotient q = floor(w / p) < 32 is kept.
+      3. The number of bytes in bytes, so that inputs which differ only in trailing zero bytes are
+         not padded to the same words.
+      4. The padding of poseidon_hash_many of Cairo: 1, followed by 0 if needed to make the length
+         of the sequence even.
+    Let q_j be the quotient of the word that e_j was reduced from, or 0 if e_j is not a word.
+    Starting from the state (0, 0, 0), for each j = 0, ..., k-1, adds e_{2j} to s0, e_{2j+1} to s1
+    and q_{2j} + 32 * q_{2j+1} to s2, and applies the permutation. Returns s0.
+    The quotients, which are absorbed to the capacity, make the map from bytes to the sponge input
+    injective. If all the quotients are 0 (in particular, if all the words are smaller than p), the
+    result is poseidon_hash_many(initial_hash, w_1, ..., w_n, len(bytes)) of Cairo. Otherwise, it is
+    not a function that Cairo provides.
+  */
+  static Poseidon3 HashBytesWithLength(
+      gsl::span<const std::byte> bytes, const Poseidon3& initial_hash);
+
+  bool operator==(const Poseidon3& other) const;
+  bool operator!=(const Poseidon3& other) const;
+
+  const std::array<std::byte, kDigestNumBytes> GetDigest() const {
+    std::array<std::byte, kDigestNumBytes> output{};
+    state_.ToStandardForm().ToBytes(output);
+    return output;
+  }
+
+  std::string ToString() const;
+  friend std::ostream& operator<<(std::ostream& out, const Poseidon3& hash);
+
+ private:
+  explicit Poseidon3(const FieldElementT& state) : state_(state) {}
+
+  FieldElementT state_;
+};
+
+}  // namespace starkware
+
+#include "starkware/crypt_tools/poseidon.inl"
+
+#endif  // STARKWARE_CRYPT_TOOLS_POSEIDON_H_
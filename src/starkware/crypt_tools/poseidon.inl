@@ -0,0 +1,94 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#include "starkware/crypt_tools/poseidon.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "starkware/crypt_tools/hash_context/poseidon_hash_context.h"
+#include "starkware/error_handling/error_handling.h"
+
+namespace starkware {
+
+inline Poseidon3 Poseidon3::InitDigestTo(const gsl::span<const std::byte>& digest) {
+  return Poseidon3(FieldElementT::FromBigInt(ValueType::FromBytes(digest)));
+}
+
+inline Poseidon3 Poseidon3::Hash(const Poseidon3& val0, const Poseidon3& val1) {
+  return Poseidon3(GetStandardPoseidonHashContext().Hash(val0.state_, val1.state_));
+}
+
+inline Poseidon3 Poseidon3::HashBytesWithLength(gsl::span<const std::byte> bytes) {
+  return Poseidon3::HashBytesWithLength(bytes, Poseidon3(FieldElementT::Zero()));
+}
+
+inline Poseidon3 Poseidon3::HashBytesWithLength(
+    gsl::span<const std::byte> bytes, const Poseidon3& initial_hash) {
+  const auto& ctx = GetStandardPoseidonHashContext();
+  const auto modulus = FieldElementT::GetModulus();
+  // The largest quotient of a word by the modulus is 31.
+  constexpr uint64_t kShiftBound = 32;
+
+  // The absorbed field elements and the quotients of the words they were reduced from (see the
+  // format in poseidon.h).
+  std::vector<FieldElementT> elements = {initial_hash.state_};
+  std::vector<uint64_t> shifts = {0};
+  const size_t n_words = (bytes.size() + kDigestNumBytes - 1) / kDigestNumBytes;
+  elements.reserve(n_words + 4);
+  shifts.reserve(n_words + 4);
+  for (size_t offset = 0; offset < bytes.size(); offset += kDigestNumBytes) {
+    std::array<std::byte, kDigestNumBytes> word_bytes{};
+    const auto chunk = bytes.subspan(offset, std::min(kDigestNumBytes, bytes.size() - offset));
+    std::copy(chunk.begin(), chunk.end(), word_bytes.begin());
+    const auto [q, r] = ValueType::FromBytes(word_bytes).Div(modulus);  // NOLINT
+    ASSERT_RELEASE(q < ValueType(kShiftBound), "Unexpectedly large shift.");
+    elements.push_back(FieldElementT::FromBigInt(r));
+    shifts.push_back(q[0]);
+  }
+  // The length element.
+  elements.push_back(FieldElementT::FromUint(bytes.size()));
+  shifts.push_back(0);
+
+  // The padding of poseidon_hash_many: a one, and then a zero if needed to fill the rate.
+  elements.push_back(FieldElementT::One());
+  shifts.push_back(0);
+  if (elements.size() % 2 != 0) {
+    elements.push_back(FieldElementT::Zero());
+    shifts.push_back(0);
+  }
+
+  PoseidonHashContext<FieldElementT>::State state{
+      FieldElementT::Zero(), FieldElementT::Zero(), FieldElementT::Zero()};
+  for (size_t i = 0; i < elements.size(); i += 2) {
+    state[0] += elements[i];
+    state[1] += elements[i + 1];
+    // The capacity element absorbs the quotients of both words.
+    state[2] += FieldElementT::FromUint(shifts[i] + kShiftBound * shifts[i + 1]);
+    ctx.Permute(&state);
+  }
+  return Poseidon3(state[0]);
+}
+
+inline std::string Poseidon3::ToString() const { return state_.ToStandardForm().ToString(); }
+
+inline std::ostream& operator<<(std::ostream& out, const Poseidon3& hash) {
+  return out << hash.ToString();
+}
+
+inline bool Poseidon3::operator==(const Poseidon3& other) const { return state_ == other.state_; }
+inline bool Poseidon3::operator!=(const Poseidon3& other) const { return state_ != other.state_; }
+
+}  // namespace starkware
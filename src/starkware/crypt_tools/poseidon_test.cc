@@ -0,0 +1,181 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+
+#include "starkware/crypt_tools/poseidon.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "third_party/gsl/gsl-lite.hpp"
+
+#include "starkware/algebra/big_int.h"
+#include "starkware/crypt_tools/hash_context/poseidon_hash_context.h"
+#include "starkware/crypt_tools/test_utils.h"
+#include "starkware/utils/serialization.h"
+
+namespace starkware {
+namespace {
+
+using FieldElementT = Poseidon3::FieldElementT;
+
+Poseidon3 AsDigest(const BigInt<4>& val) {
+  std::array<std::byte, BigInt<4>::SizeInBytes()> bytes{};
+  Serialize(val, bytes, /*use_big_endian=*/true);
+
+  return Poseidon3::InitDigestTo(bytes);
+}
+
+/*
+  poseidon_hash_many of Cairo: absorbs elements, padded with a one and then a zero if needed, two at
+  a time into the rate of the sponge, and returns the first element of the state.
+*/
+FieldElementT PoseidonHashMany(std::vector<FieldElementT> elements) {
+  elements.push_back(FieldElementT::One());
+  if (elements.size() % 2 != 0) {
+    elements.push_back(FieldElementT::Zero());
+  }
+  PoseidonHashContext<FieldElementT>::State state{
+      FieldElementT::Zero(), FieldElementT::Zero(), FieldElementT::Zero()};
+  for (size_t i = 0; i < elements.size(); i += 2) {
+    state[0] += elements[i];
+    state[1] += elements[i + 1];
+    GetStandardPoseidonHashContext().Permute(&state);
+  }
+  return state[0];
+}
+
+Poseidon3 AsDigest(const FieldElementT& val) { return AsDigest(val.ToStandardForm()); }
+
+TEST(Poseidon3, Permutation) {
+  PoseidonHashContext<FieldElementT>::State state{
+      FieldElementT::Zero(), FieldElementT::Zero(), FieldElementT::Zero()};
+  GetStandardPoseidonHashContext().Permute(&state);
+  EXPECT_EQ(
+      FieldElementT::FromBigInt(
+          0x79e8d1e78258000a28fc9d49e233bc6852357968577b1e386550ed6a9086133_Z),
+      state[0]);
+  EXPECT_EQ(
+      FieldElementT::FromBigInt(
+          0x3840d003d0f3f96dbb796ff6aa6a63be5b5404b91ccaabca256154cbb6fb984_Z),
+      state[1]);
+  EXPECT_EQ(
+      FieldElementT::FromBigInt(
+          0x1eb39da3f7d3b04142d0ac83d9da00c9325a61fb2ef326e50b70eaa8a3c7cc7_Z),
+      state[2]);
+}
+
+TEST(Poseidon3, Hash) {
+  // poseidon_hash(x, y) in Cairo.
+  EXPECT_EQ(
+      AsDigest(0x75540825a6ecc5dc7d7c2f5f868164182742227f1367d66c43ee51ec7937a81_Z),
+      Poseidon3::Hash(
+          AsDigest(0xb662f9017fa7956fd70e26129b1833e10ad000fd37b4d9f4e0ce6884b7bbe_Z),
+          AsDigest(0x1fe356bf76102cdae1bfbdc173602ead228b12904c00dad9cf16e035468bea_Z)));
+}
+
+TEST(Poseidon3, EmptyString) {
+  std::array<std::byte, 0> in{};
+
+  EXPECT_EQ(
+      AsDigest(0x1fb7169b936dd880cb7ebc50e932a495a60e0084cdab94a681040cb4006e1a0_Z),
+      Poseidon3::HashBytesWithLength(in));
+}
+
+TEST(Poseidon3, TestVectors) {
+  // Regression vectors, computed by this implementation (see SpongeFormat for the format).
+  EXPECT_EQ(
+      AsDigest(0x1b7b163b53284aa4157d2741a9cd4d1680e8b1a290d71257c66c8fc3a94ddd9_Z),
+      Poseidon3::HashBytesWithLength(GenerateTestVector(32)));
+
+  // A partial block.
+  EXPECT_EQ(
+      AsDigest(0x7de713dc090e46579f86b260a4649c1436f2991ca8e7a0564fbdeedf306e8b3_Z),
+      Poseidon3::HashBytesWithLength(GenerateTestVector(41)));
+
+  EXPECT_EQ(
+      AsDigest(0x6fa217a81f86eae8da31e07b959ab8bfd39b25fa3ee738522a647fb2aa421f0_Z),
+      Poseidon3::HashBytesWithLength(GenerateTestVector(64)));
+}
+
+TEST(Poseidon3, WordsLargerThanModulus) {
+  // A word is not identified with its reduction modulo the field prime.
+  const std::vector<std::byte> large_word(Poseidon3::kDigestNumBytes, std::byte(0xff));
+  std::array<std::byte, Poseidon3::kDigestNumBytes> reduced_word{};
+  Serialize(
+      BigInt<4>::FromBytes(large_word).Div(FieldElementT::GetModulus()).second, reduced_word,
+      /*use_big_endian=*/true);
+
+  EXPECT_EQ(
+      AsDigest(0xfc7fc719c4a6ac80d5a84149779905181f1beaba2d841d569f2d33bc820933_Z),
+      Poseidon3::HashBytesWithLength(large_word));
+  EXPECT_EQ(
+      AsDigest(0x1dc8f196c382be992475445d25b2debbfd41fab2f188f789d0f7d67616b3af5_Z),
+      Poseidon3::HashBytesWithLength(reduced_word));
+}
+
+TEST(Poseidon3, SpongeFormat) {
+  // Words smaller than the field prime, the last of which is partial.
+  std::vector<std::byte> data = GenerateTestVector(3 * Poseidon3::kDigestNumBytes + 5);
+  for (size_t i = 0; i < data.size(); i += Poseidon3::kDigestNumBytes) {
+    data[i] &= std::byte(0x07);
+  }
+  std::vector<FieldElementT> words;
+  for (size_t i = 0; i < data.size(); i += Poseidon3::kDigestNumBytes) {
+    std::array<std::byte, Poseidon3::kDigestNumBytes> word{};
+    const auto chunk = gsl::make_span(data).subspan(
+        i, std::min(Poseidon3::kDigestNumBytes, data.size() - i));
+    std::copy(chunk.begin(), chunk.end(), word.begin());
+    words.push_back(FieldElementT::FromBigInt(BigInt<4>::FromBytes(word)));
+  }
+
+  // The initial hash, the words and the length, hashed by poseidon_hash_many.
+  for (const FieldElementT& initial_hash : {FieldElementT::Zero(), FieldElementT::FromUint(7)}) {
+    std::vector<FieldElementT> elements = {initial_hash};
+    elements.insert(elements.end(), words.begin(), words.end());
+    elements.push_back(FieldElementT::FromUint(data.size()));
+    EXPECT_EQ(
+        AsDigest(PoseidonHashMany(elements)),
+        Poseidon3::HashBytesWithLength(data, AsDigest(initial_hash)));
+  }
+
+  // The quotient of a word larger than the field prime is added to the capacity element.
+  const std::vector<std::byte> large_word(Poseidon3::kDigestNumBytes, std::byte(0xff));
+  const auto [quotient, remainder] =  // NOLINT
+      BigInt<4>::FromBytes(large_word).Div(FieldElementT::GetModulus());
+  PoseidonHashContext<FieldElementT>::State state{
+      FieldElementT::Zero(), FieldElementT::FromBigInt(remainder),
+      FieldElementT::FromUint(32 * quotient[0])};
+  GetStandardPoseidonHashContext().Permute(&state);
+  state[0] += FieldElementT::FromUint(Poseidon3::kDigestNumBytes);
+  state[1] += FieldElementT::One();
+  GetStandardPoseidonHashContext().Permute(&state);
+  EXPECT_EQ(AsDigest(state[0]), Poseidon3::HashBytesWithLength(large_word));
+}
+
+TEST(Poseidon3, InitialHash) {
+  const auto data = GenerateTestVector(48);
+  EXPECT_EQ(
+      Poseidon3::HashBytesWithLength(data),
+      Poseidon3::HashBytesWithLength(data, AsDigest(BigInt<4>::Zero())));
+  EXPECT_NE(
+      Poseidon3::HashBytesWithLength(data),
+      Poseidon3::HashBytesWithLength(data, AsDigest(BigInt<4>::One())));
+}
+
+}  // namespace
+}  // namespace starkware
@@ -20,6 +20,7 @@
 #include "starkware/crypt_tools/keccak_256.h"
 #include "starkware/crypt_tools/masked_hash.h"
 #include "starkware/crypt_tools/pedersen.h"
+#include "starkware/crypt_tools/poseidon.h"
 
 #define INSTANTIATE_FOR_ALL_HASH_FUNCTIONS(ClassName)                     \
   /* NOLINTNEXTLINE */                                                    \
@@ -35,6 +36,8 @@
   /* NOLINTNEXTLINE */                                                    \
   template class ClassName<starkware::MaskedHash<Keccak256, 20, true>>;   \
   /* NOLINTNEXTLINE */                                                    \
-  template class ClassName<starkware::MaskedHash<Keccak256, 20, false>>;
+  template class ClassName<starkware::MaskedHash<Keccak256, 20, false>>; \
+  /* NOLINTNEXTLINE */                                                    \
+  template class ClassName<starkware::Poseidon3>;
 
 #endif  // STARKWARE_CRYPT_TOOLS_TEMPLATE_INSTANTIATION_H_
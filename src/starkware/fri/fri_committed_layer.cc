@@ -14,9 +14,11 @@
 
 #include "starkware/fri/fri_committed_layer.h"
 
+#include <array>
 #include <set>
 
 #include "starkware/fri/fri_details.h"
+#include "starkware/utils/task_manager.h"
 
 namespace starkware {
 
@@ -49,24 +51,28 @@ FriCommittedLayerByTableProver::FriCommittedLayerByTableProver(
 
 FriCommittedLayerByTableProver::ElementsData FriCommittedLayerByTableProver::EvalAtPoints(
     const gsl::span<uint64_t>& required_row_indices) {
-  // Create a vector and a span totally matching. Span cannot be independent.
-  // It's needed in order to have the ability of getting subspans.
   ElementsData elements_data;
   auto& [elements_data_spans, elements_data_vectors] = elements_data;
 
-  size_t coset_size = Pow2(params_.fri_step_list[layer_num_]);
-  elements_data_vectors.reserve(coset_size);
-  elements_data_spans.reserve(coset_size);
-
+  // Evaluate all the columns in a single call, ordered column by column, so that the layer can
+  // evaluate all the points together (e.g., using a single fast multipoint evaluation for out of
+  // memory layers) rather than a handful of points at a time.
+  const size_t coset_size = Pow2(params_.fri_step_list[layer_num_]);
+  const size_t n_rows = required_row_indices.size();
+  std::vector<uint64_t> required_indices;
+  required_indices.reserve(coset_size * n_rows);
   for (uint64_t col = 0; col < coset_size; col++) {
-    std::vector<uint64_t> required_indices;
     for (uint64_t row : required_row_indices) {
       required_indices.push_back(row * coset_size + col);
     }
+  }
+  elements_data_vectors.push_back(fri_layer_->EvalAtPoints(required_indices));
 
-    FieldElementVector res = fri_layer_->EvalAtPoints(required_indices);
-    elements_data_vectors.push_back(std::move(res));
-    elements_data_spans.emplace_back(elements_data_vectors[col]);
+  // Each column is a span into the evaluation.
+  const ConstFieldElementSpan all_columns(elements_data_vectors[0]);
+  elements_data_spans.reserve(coset_size);
+  for (uint64_t col = 0; col < coset_size; col++) {
+    elements_data_spans.push_back(all_columns.SubSpan(col * n_rows, n_rows));
   }
   return elements_data;
 }
@@ -75,23 +81,54 @@ void FriCommittedLayerByTableProver::Commit() {
   uint64_t chunk_size = fri_layer_->ChunkSize();
   uint64_t n_chunks = SafeDiv(fri_layer_->LayerSize(), chunk_size);
   auto storage = fri_layer_->MakeStorage();
+  if (n_chunks == 1) {
+    ConstFieldElementSpan chunk = fri_layer_->GetChunk(storage.get(), chunk_size, 0);
+    table_prover_->AddSegmentForCommitment({chunk}, 0, Pow2(fri_step_));
+    table_prover_->Commit();
+    return;
+  }
+
+  // Double buffering: while chunk i is hashed into the commitment, chunk i + 1 is computed (folded
+  // or interpolated) into the other buffer. Only the computing task touches the storage, so the
+  // chunks are requested in order, as FriLayer::GetChunk() expects.
+  const Field field = fri_layer_->GetDomain()->GetField();
+  std::array<FieldElementVector, 2> buffers{
+      FieldElementVector::MakeUninitialized(field, chunk_size),
+      FieldElementVector::MakeUninitialized(field, chunk_size)};
+  fri_layer_->GetChunk(storage.get(), buffers[0], chunk_size, 0);
   for (uint64_t index = 0; index < n_chunks; ++index) {
-    ConstFieldElementSpan chunk = fri_layer_->GetChunk(storage.get(), chunk_size, index);
-    table_prover_->AddSegmentForCommitment({chunk}, index, Pow2(fri_step_));
+    TaskManager::GetInstance().ParallelFor(2, [&](const TaskInfo& task_info) {
+      if (task_info.start_idx == 0) {
+        table_prover_->AddSegmentForCommitment(
+            {ConstFieldElementSpan(buffers[index % 2])}, index, Pow2(fri_step_));
+      } else if (index + 1 < n_chunks) {
+        fri_layer_->GetChunk(storage.get(), buffers[(index + 1) % 2], chunk_size, index + 1);
+      }
+    });
   }
   table_prover_->Commit();
 }
 
-void FriCommittedLayerByTableProver::Decommit(const std::vector<uint64_t>& queries) {
+void FriCommittedLayerByTableProver::PrepareDecommitment(const std::vector<uint64_t>& queries) {
   std::set<RowCol> layer_data_queries, layer_integrity_queries;
   NextLayerDataAndIntegrityQueries(
       queries, params_, layer_num_, &layer_data_queries, &layer_integrity_queries);
   std::vector<uint64_t> required_row_indices =
       table_prover_->StartDecommitmentPhase(layer_data_queries, layer_integrity_queries);
 
-  ElementsData elements_data(EvalAtPoints(required_row_indices));
+  prepared_decommitment_ = PreparedDecommitment{queries, EvalAtPoints(required_row_indices)};
+}
+
+void FriCommittedLayerByTableProver::Decommit(const std::vector<uint64_t>& queries) {
+  if (!prepared_decommitment_.has_value()) {
+    PrepareDecommitment(queries);
+  }
+  ASSERT_RELEASE(
+      prepared_decommitment_->queries == queries,
+      "Decommit() was called with different queries than PrepareDecommitment()");
 
-  table_prover_->Decommit(elements_data.elements);
+  table_prover_->Decommit(prepared_decommitment_->elements_data.elements);
+  prepared_decommitment_.reset();
 }
 
 }  // namespace starkware
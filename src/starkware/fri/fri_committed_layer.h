@@ -16,6 +16,7 @@
 #define STARKWARE_FRI_FRI_COMMITTED_LAYER_H_
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -34,6 +35,14 @@ class FriCommittedLayer {
  public:
   explicit FriCommittedLayer(size_t fri_step) : fri_step_(fri_step) {}
   virtual ~FriCommittedLayer() = default;
+
+  /*
+    Computes the values that Decommit() needs for the given queries, without sending anything on
+    the channel. This allows preparing several layers concurrently before decommitting them in
+    order. Calling it is optional; layers which have nothing to prepare ignore it.
+  */
+  virtual void PrepareDecommitment(const std::vector<uint64_t>& /* queries */) {}
+
   virtual void Decommit(const std::vector<uint64_t>& queries) = 0;
 
  protected:
@@ -68,6 +77,8 @@ class FriCommittedLayerByTableProver : public FriCommittedLayer {
       const TableProverFactory& table_prover_factory, const FriParameters& params,
       size_t layer_num);
 
+  void PrepareDecommitment(const std::vector<uint64_t>& queries) override;
+
   void Decommit(const std::vector<uint64_t>& queries) override;
 
  private:
@@ -77,12 +88,21 @@ class FriCommittedLayerByTableProver : public FriCommittedLayer {
     std::vector<FieldElementVector> raw_data;
   };
 
+  /*
+    The result of PrepareDecommitment(), consumed by Decommit().
+  */
+  struct PreparedDecommitment {
+    std::vector<uint64_t> queries;
+    ElementsData elements_data;
+  };
+
   ElementsData EvalAtPoints(const gsl::span<uint64_t>& required_row_indices);
 
   MaybeOwnedPtr<const FriLayer> fri_layer_;
   const FriParameters& params_;
   const size_t layer_num_;
   std::unique_ptr<TableProver> table_prover_;
+  std::optional<PreparedDecommitment> prepared_decommitment_;
 };
 
 }  // namespace starkware
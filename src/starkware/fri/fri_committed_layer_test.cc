@@ -17,6 +17,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "starkware/algebra/lde/lde.h"
+#include "starkware/channel/noninteractive_prover_channel.h"
 #include "starkware/channel/prover_channel_mock.h"
 #include "starkware/crypt_tools/blake2s.h"
 #include "starkware/fri/fri_folder.h"
@@ -109,6 +110,64 @@ TYPED_TEST(FriCommittedLayerTest, FriCommittedLayerByTableProver) {
   committed_layer.Decommit(queries);
 }
 
+/*
+  Commits on a layer, decommits a few queries and returns the generated proof.
+*/
+std::vector<std::byte> CommitAndDecommit(
+    MaybeOwnedPtr<const FriLayer> layer, const FriParameters& params) {
+  NoninteractiveProverChannel prover_channel(Prng(MakeByteArray<0xca, 0xfe>()).Clone());
+  TableProverFactory table_prover_factory = GetTableProverFactory<Blake2s256>(
+      &prover_channel, FieldElementT::SizeInBytes(), 32, 1, 0,
+      CommitmentHashes(Blake2s256::HashName()));
+  FriCommittedLayerByTableProver committed_layer(
+      1, std::move(layer), table_prover_factory, params, 2);
+  committed_layer.Decommit({2, 4, 6});
+  return prover_channel.GetProof();
+}
+
+/*
+  Committing on a layer chunk by chunk (while the next chunk is folded) yields the same proof as
+  committing on the whole layer at once.
+*/
+TEST(FriCommittedLayerByTableProver, ChunkedCommitment) {
+  Prng prng;
+  std::unique_ptr<details::FriFolderBase> folder(
+      details::FriFolderFromField(Field::Create<FieldElementT>()));
+  const size_t log2_eval_domain = 10;
+  const size_t last_layer_degree_bound = 5;
+  const FieldElementT offset(FftMultiplicativeGroup<FieldElementT>::GroupUnit());
+  FftBasesDefaultImpl<FieldElementT> bases = MakeFftBases(log2_eval_domain, offset);
+  FriParameters params(
+      {{2, 3, 1} /*fri_step_list=*/,
+       last_layer_degree_bound /*last_layer_degree_bound=*/,
+       2 /*n_queries=*/,
+       UseOwned(&bases) /*fft_bases=*/,
+       Field::Create<FieldElementT>() /*field=*/,
+       15 /*proof_of_work_bits=*/});
+
+  details::TestPolynomial<FieldElementT> test_layer(&prng, 64 * last_layer_degree_bound);
+  std::vector<FieldElementT> eval_domain_data = test_layer.GetData(bases[0]);
+
+  // A witness of a quarter of the evaluation domain splits the layers into 4 chunks.
+  const size_t prefix_size = SafeDiv(Pow2(log2_eval_domain), 4);
+  FieldElementVector evaluation(FieldElementVector::CopyFrom(std::vector<FieldElementT>(
+      eval_domain_data.begin(), eval_domain_data.begin() + prefix_size)));
+  FieldElement eval_point = FieldElement(FieldElementT::RandomElement(&prng));
+  const FriProverConfig fri_prover_config{
+      FriProverConfig::kDefaultMaxNonChunkedLayerSize,
+      FriProverConfig::kDefaultNumberOfChunksBetweenLayers, FriProverConfig::kAllInMemoryLayers};
+
+  FriLayerOutOfMemory layer_0_out(std::move(evaluation), UseOwned(&bases));
+  FriLayerProxy layer_1_proxy(*folder, UseOwned(&layer_0_out), eval_point, &fri_prover_config);
+  ASSERT_EQ(SafeDiv(layer_1_proxy.LayerSize(), layer_1_proxy.ChunkSize()), 4);
+  FriLayerOutOfMemory layer_1_out(UseOwned(&layer_1_proxy), layer_1_proxy.ChunkSize());
+  FriLayerInMemory layer_1_in(UseOwned(&layer_1_proxy));
+
+  EXPECT_EQ(
+      CommitAndDecommit(UseOwned(&layer_1_out), params),
+      CommitAndDecommit(UseOwned(&layer_1_in), params));
+}
+
 #endif  // #ifndef __EMSCRIPTEN__.
 
 }  // namespace
@@ -123,6 +123,31 @@ TYPED_TEST(FriDetailsTest, ComputeNextFriLayerDegreeBound800) {
   EXPECT_EQ(399, GetEvaluationDegree(res, bases.FromLayer(1)));
 }
 
+TYPED_TEST(FriDetailsTest, ComputeNextFriLayerMultiStep) {
+  using FieldElementT = TypeParam;
+  Prng prng;
+  // Large enough to be split between several tasks.
+  const size_t log_domain_size = 14;
+
+  auto bases = MakeFftBases(log_domain_size, FieldElementT::RandomElement(&prng));
+  const auto first_layer = FieldElementVector::Make(
+      prng.RandomFieldElementVector<FieldElementT>(Pow2(log_domain_size)));
+
+  for (size_t n_steps = 1; n_steps <= 4; ++n_steps) {
+    // Fold one step at a time.
+    std::vector<FieldElement> eval_points;
+    FieldElementVector expected = FieldElementVector::CopyFrom(first_layer);
+    for (size_t i = 0; i < n_steps; ++i) {
+      eval_points.push_back(FieldElement(FieldElementT::RandomElement(&prng)));
+      expected = this->folder_->ComputeNextFriLayer(bases[i], expected, eval_points.back());
+    }
+
+    auto res = FieldElementVector::MakeUninitialized(first_layer.GetField(), expected.Size());
+    this->folder_->ComputeNextFriLayerMultiStep(bases[0], first_layer, eval_points, res);
+    EXPECT_EQ(res, expected) << "n_steps = " << n_steps;
+  }
+}
+
 /*
   This test checks that if the evaluation points are x0, x0^2, x0^4, x0^8, ...
   then f_i(x0^(2^i)) = f(x0) where f_i is the i-th layer in FRI.
@@ -101,6 +101,104 @@ class MultiplicativeFriFolder : public FriFolderBase {
         });
   }
 
+  void ComputeNextFriLayerMultiStep(
+      const FftDomainBase& domain, const ConstFieldElementSpan& values,
+      gsl::span<const FieldElement> eval_points,
+      const FieldElementSpan& output_layer) const override {
+    const auto* domain_tmpl =
+        dynamic_cast<const FftDomain<FftMultiplicativeGroup<FieldElementT>>*>(&domain);
+    ASSERT_RELEASE(
+        domain_tmpl != nullptr,
+        "The underlying type of domain is wrong. It should be FftDomain<T, true>");
+
+    std::vector<FieldElementT> eval_points_tmpl;
+    eval_points_tmpl.reserve(eval_points.size());
+    for (const FieldElement& eval_point : eval_points) {
+      eval_points_tmpl.push_back(eval_point.As<FieldElementT>());
+    }
+    ComputeNextFriLayerMultiStepImpl(
+        *domain_tmpl, values.As<FieldElementT>(), eval_points_tmpl,
+        output_layer.As<FieldElementT>());
+  }
+
+  /*
+    Folds every 2^n_steps consecutive elements of input_layer (a coset of the subgroup spanned by
+    the first n_steps basis elements) to one output element, keeping the intermediate values in a
+    small buffer instead of writing whole intermediate layers.
+
+    Let x_g be the first point of group g, and y_g = x_g^(-1). The point paired with the 2m-th
+    value in the j-th folding of the group is x_g^(2^j) * r_j[m], where r_j[m] is a product of
+    (squares of) basis elements, which does not depend on g. Hence the factor eval_point * x_inv of
+    Fold() is y_g^(2^j) * (eval_points[j] * r_j[m]^(-1)), where the second factor is precomputed.
+  */
+  static void ComputeNextFriLayerMultiStepImpl(
+      const FftDomain<FftMultiplicativeGroup<FieldElementT>>& domain,
+      const gsl::span<const FieldElementT>& input_layer,
+      const gsl::span<const FieldElementT>& eval_points,
+      const gsl::span<FieldElementT>& output_layer, size_t min_log_n_fri_task_size = 12) {
+    const size_t n_steps = eval_points.size();
+    ASSERT_RELEASE(n_steps > 0, "At least one folding step is required");
+    ASSERT_RELEASE(n_steps <= domain.BasisSize(), "Too many folding steps for the domain");
+    ASSERT_RELEASE(input_layer.size() == domain.Size(), "vector size does not match domain size");
+    const size_t group_size = Pow2(n_steps);
+    ASSERT_RELEASE(
+        output_layer.size() == input_layer.size() / group_size,
+        "Output layer size must be the original size divided by 2^n_steps");
+
+    // factors[j][m] = eval_points[j] * r_j[m]^(-1), see above.
+    std::vector<std::vector<FieldElementT>> factors;
+    factors.reserve(n_steps);
+    for (size_t j = 0; j < n_steps; ++j) {
+      std::vector<FieldElementT> basis;
+      for (size_t b = j + 1; b < n_steps; ++b) {
+        FieldElementT basis_element = domain.Basis()[b];
+        for (size_t i = 0; i < j; ++i) {
+          basis_element *= basis_element;
+        }
+        basis.push_back(basis_element);
+      }
+      const auto step_domain = FftDomain<FftMultiplicativeGroup<FieldElementT>>(
+                                   std::move(basis), FieldElementT::One())
+                                   .Inverse()
+                                   .GetShiftedDomain(eval_points[j]);
+      factors.emplace_back(step_domain.begin(), step_domain.end());
+    }
+
+    // Split the groups between tasks, as in ComputeNextFriLayerImpl(). y_g is the product of an
+    // element of the outer domain (one per task) and an element of the inner domain.
+    const size_t log_n_groups = domain.BasisSize() - n_steps;
+    const size_t log_n_fri_tasks = std::min<size_t>(
+        log_n_groups,
+        static_cast<size_t>(std::max<int64_t>(domain.BasisSize() - min_log_n_fri_task_size, 0)));
+    const auto& [inner_domain, outer_domain] =
+        domain.RemoveFirstBasisElements(n_steps).Inverse().Split(log_n_fri_tasks);
+
+    std::vector<FieldElementT> outer_vec(outer_domain.begin(), outer_domain.end());
+    std::vector<FieldElementT> inner_vec(inner_domain.begin(), inner_domain.end());
+    const size_t task_size = inner_vec.size();
+
+    TaskManager::GetInstance().ParallelFor(outer_vec.size(), [&](const TaskInfo& task_info) {
+      std::vector<FieldElementT> buffer = FieldElementT::UninitializedVector(group_size / 2);
+      size_t group_index = task_info.start_idx * task_size;
+      for (const FieldElementT& inner : inner_vec) {
+        FieldElementT y_power = outer_vec[task_info.start_idx] * inner;
+        const FieldElementT* group = &input_layer[group_index * group_size];
+        for (size_t m = 0; m < group_size / 2; ++m) {
+          buffer[m] = Fold(group[2 * m], group[2 * m + 1], y_power, factors[0][m]);
+        }
+        for (size_t j = 1; j < n_steps; ++j) {
+          y_power *= y_power;
+          // Folding in place is safe, since buffer[m] is written after buffer[2m] and buffer[2m+1]
+          // are read.
+          for (size_t m = 0; m < factors[j].size(); ++m) {
+            buffer[m] = Fold(buffer[2 * m], buffer[2 * m + 1], y_power, factors[j][m]);
+          }
+        }
+        output_layer[group_index++] = buffer[0];
+      }
+    });
+  }
+
   FieldElement NextLayerElementFromTwoPreviousLayerElements(
       const FieldElement& f_x, const FieldElement& f_minus_x, const FieldElement& eval_point,
       const FieldElement& x) const override {
@@ -41,6 +41,16 @@ class FriFolderBase {
       const FftDomainBase& domain, const ConstFieldElementSpan& values,
       const FieldElement& eval_point, const FieldElementSpan& output_layer) const = 0;
 
+  /*
+    Computes the values of the FRI layer which is eval_points.size() layers after the current one,
+    without computing the layers in between. Each 2^eval_points.size() consecutive values are
+    folded to one element of the output, where eval_points[i] is the evaluation point of the i-th
+    folding. The result is the same as calling ComputeNextFriLayer() eval_points.size() times.
+  */
+  virtual void ComputeNextFriLayerMultiStep(
+      const FftDomainBase& domain, const ConstFieldElementSpan& values,
+      gsl::span<const FieldElement> eval_points, const FieldElementSpan& output_layer) const = 0;
+
   /*
     Computes the value of a single element in the next FRI layer given two corresponding
     elements in the current layer.
@@ -17,9 +17,27 @@
 #include <algorithm>
 
 #include "starkware/algebra/lde/lde.h"
+#include "starkware/algebra/utils/invoke_template_version.h"
 
 namespace starkware {
 
+namespace {
+
+/*
+  Returns the elements of evaluation at the given indices.
+*/
+FieldElementVector GatherAtIndices(
+    const ConstFieldElementSpan& evaluation, const gsl::span<uint64_t>& indices) {
+  FieldElementVector res = FieldElementVector::Make(evaluation.GetField());
+  res.Reserve(indices.size());
+  for (uint64_t i : indices) {
+    res.PushBack(evaluation[i]);
+  }
+  return res;
+}
+
+}  // namespace
+
 //  Class FriLayer.
 
 /*
@@ -63,12 +81,7 @@ void FriLayerInMemory::GetChunk(
 
 FieldElementVector FriLayerInMemory::EvalAtPoints(
     const gsl::span<uint64_t>& required_indices) const {
-  FieldElementVector res = FieldElementVector::Make(GetDomain()->GetField());
-  res.Reserve(required_indices.size());
-  for (uint64_t i : required_indices) {
-    res.PushBack(evaluation_[i]);
-  }
-  return res;
+  return GatherAtIndices(evaluation_, required_indices);
 }
 
 //  Class FriLayerOutOfMemory.
@@ -188,18 +201,103 @@ std::unique_ptr<FriLayer::Storage> FriLayerOutOfMemory::MakeStorage() const {
   return std::make_unique<OutOfMemoryStorage>();
 }
 
+//  Class FriLayerOnScratchFile.
+
+namespace {
+
+size_t FieldElementSize(const Field& field) {
+  return InvokeFieldTemplateVersion(
+      [](auto field_tag) {
+        using FieldElementT = typename decltype(field_tag)::type;
+        return sizeof(FieldElementT);
+      },
+      field);
+}
+
+FieldElementSpan MakeFieldElementSpan(std::byte* data, size_t size, const Field& field) {
+  return InvokeFieldTemplateVersion(
+      [&](auto field_tag) {
+        using FieldElementT = typename decltype(field_tag)::type;
+        return FieldElementSpan(gsl::make_span(reinterpret_cast<FieldElementT*>(data), size));
+      },
+      field);
+}
+
+ConstFieldElementSpan AsConstSpan(const FieldElementSpan& span) {
+  return InvokeFieldTemplateVersion(
+      [&](auto field_tag) {
+        using FieldElementT = typename decltype(field_tag)::type;
+        return ConstFieldElementSpan(gsl::span<const FieldElementT>(span.As<FieldElementT>()));
+      },
+      span.GetField());
+}
+
+/*
+  Returns the largest power of two number of elements that fit in max_chunk_bytes (at least 1).
+*/
+uint64_t MaxChunkSize(uint64_t max_chunk_bytes, size_t element_size) {
+  return Pow2(Log2Floor(std::max<uint64_t>(max_chunk_bytes / element_size, 1)));
+}
+
+std::unique_ptr<ScratchFileMapping> MakeScratchFile(size_t size_in_bytes) {
+  ASSERT_RELEASE(!FLAGS_scratch_dir.empty(), "FriLayerOnScratchFile requires --scratch_dir.");
+  return std::make_unique<ScratchFileMapping>(FLAGS_scratch_dir, size_in_bytes);
+}
+
+}  // namespace
+
+FriLayerOnScratchFile::FriLayerOnScratchFile(
+    MaybeOwnedPtr<const FriLayer> prev_layer, uint64_t max_chunk_bytes)
+    : FriLayer(CloneDomain(prev_layer->GetDomain())),
+      mapping_(MakeScratchFile(layer_size_ * FieldElementSize(GetDomain()->GetField()))),
+      evaluation_(MakeFieldElementSpan(mapping_->Data(), layer_size_, GetDomain()->GetField())),
+      chunk_size_(std::min<uint64_t>(
+          layer_size_,
+          MaxChunkSize(max_chunk_bytes, FieldElementSize(GetDomain()->GetField())))) {
+  // Fill the file with the chunks of the previous layer, one at a time.
+  const size_t prev_chunk_size = prev_layer->ChunkSize();
+  auto storage = prev_layer->MakeStorage();
+  for (size_t chunk_index = 0; chunk_index < SafeDiv(layer_size_, prev_chunk_size);
+       ++chunk_index) {
+    prev_layer->GetChunk(
+        storage.get(), evaluation_.SubSpan(chunk_index * prev_chunk_size, prev_chunk_size),
+        prev_chunk_size, chunk_index);
+  }
+}
+
+ConstFieldElementSpan FriLayerOnScratchFile::GetChunk(
+    Storage* /* storage */, size_t requested_size, size_t chunk_index) const {
+  ASSERT_RELEASE(
+      requested_size <= chunk_size_ && chunk_index < SafeDiv(layer_size_, requested_size),
+      "Bad parameters for FriLayerOnScratchFile::GetChunk");
+  return AsConstSpan(evaluation_.SubSpan(chunk_index * requested_size, requested_size));
+}
+
+void FriLayerOnScratchFile::GetChunk(
+    Storage* storage, const FieldElementSpan& output, size_t requested_size,
+    size_t chunk_index) const {
+  output.CopyDataFrom(GetChunk(storage, requested_size, chunk_index));
+}
+
+FieldElementVector FriLayerOnScratchFile::EvalAtPoints(
+    const gsl::span<uint64_t>& required_indices) const {
+  return GatherAtIndices(AsConstSpan(evaluation_), required_indices);
+}
+
 //  Class FriLayerProxy.
 
 FriLayerProxy::FriLayerProxy(
-    const FriFolderBase& folder, MaybeOwnedPtr<const FriLayer> prev_layer, FieldElement eval_point,
-    const FriProverConfig* fri_prover_config)
-    : FriLayer(FoldDomain(prev_layer->GetDomain())),
+    const FriFolderBase& folder, MaybeOwnedPtr<const FriLayer> prev_layer,
+    std::vector<FieldElement> eval_points, const FriProverConfig* fri_prover_config)
+    : FriLayer(FoldDomain(prev_layer->GetDomain(), eval_points.size())),
       folder_(folder),
       prev_layer_(std::move(prev_layer)),
-      eval_point_(std::move(eval_point)),
+      eval_points_(std::move(eval_points)),
       fri_prover_config_(fri_prover_config),
       chunk_size_(CalculateChunkSize()) {
-  std::tie(coset_bases_, coset_offsets_) = SplitToCosets(prev_layer_->GetDomain(), ChunkSize() * 2);
+  ASSERT_RELEASE(!eval_points_.empty(), "A proxy layer must fold at least once.");
+  std::tie(coset_bases_, coset_offsets_) =
+      SplitToCosets(prev_layer_->GetDomain(), ChunkSize() * Pow2(eval_points_.size()));
 }
 
 /*
@@ -207,42 +305,52 @@ FriLayerProxy::FriLayerProxy(
   big and not already divided into chunks. The layer is considered as too big if it is bigger than
   max_non_chunked_layer_size.
   Big non-chunked layers are divided into n_chunks_between_layers chunks.
+  A proxy which folds several times has the chunk size of the last proxy in the equivalent chain.
 */
 uint64_t FriLayerProxy::CalculateChunkSize() {
   uint64_t prev_layer_size = prev_layer_->LayerSize();
   uint64_t prev_layer_chunk_size = prev_layer_->ChunkSize();
-  bool not_split = prev_layer_chunk_size == prev_layer_size;
-  return (not_split && prev_layer_size > fri_prover_config_->max_non_chunked_layer_size)
-             ? std::max(
-                   fri_prover_config_->max_non_chunked_layer_size,
-                   SafeDiv(prev_layer_size, fri_prover_config_->n_chunks_between_layers))
-             : SafeDiv(prev_layer_chunk_size, 2);
+  for (size_t step = 0; step < eval_points_.size(); ++step) {
+    bool not_split = prev_layer_chunk_size == prev_layer_size;
+    prev_layer_chunk_size =
+        (not_split && prev_layer_size > fri_prover_config_->max_non_chunked_layer_size)
+            ? std::max(
+                  fri_prover_config_->max_non_chunked_layer_size,
+                  SafeDiv(prev_layer_size, fri_prover_config_->n_chunks_between_layers))
+            : SafeDiv(prev_layer_chunk_size, 2);
+    prev_layer_size = SafeDiv(prev_layer_size, 2);
+  }
+  return prev_layer_chunk_size;
+}
+
+void FriLayerProxy::FoldChunk(
+    size_t requested_size, size_t chunk_index, const FieldElementSpan& output) const {
+  const auto chunk_domain = coset_bases_->GetShiftedBasesAsUniquePtr(coset_offsets_[chunk_index]);
+
+  auto prev_storage = prev_layer_->MakeStorage();
+  auto chunk = prev_layer_->GetChunk(
+      prev_storage.get(), requested_size * Pow2(eval_points_.size()), chunk_index);
+  if (eval_points_.size() == 1) {
+    folder_.ComputeNextFriLayer(chunk_domain->At(0), chunk, eval_points_[0], output);
+  } else {
+    folder_.ComputeNextFriLayerMultiStep(chunk_domain->At(0), chunk, eval_points_, output);
+  }
 }
 
 ConstFieldElementSpan FriLayerProxy::GetChunk(
     Storage* storage, size_t requested_size, size_t chunk_index) const {
-  const auto chunk_domain = coset_bases_->GetShiftedBasesAsUniquePtr(coset_offsets_[chunk_index]);
   ASSERT_DEBUG(requested_size == ChunkSize(), "requested_size is different than ChunkSize()");
 
   ProxyStorage* proxy_storage = dynamic_cast<ProxyStorage*>(storage);
-
-  auto prev_storage = prev_layer_->MakeStorage();
-  folder_.ComputeNextFriLayer(
-      chunk_domain->At(0),
-      prev_layer_->GetChunk(prev_storage.get(), requested_size * 2, chunk_index), eval_point_,
-      proxy_storage->accumulation);
+  FoldChunk(requested_size, chunk_index, proxy_storage->accumulation);
   return proxy_storage->accumulation;
 }
 
 void FriLayerProxy::GetChunk(
     Storage* /* storage */, const FieldElementSpan& output, size_t requested_size,
     size_t chunk_index) const {
-  const auto chunk_domain = coset_bases_->GetShiftedBasesAsUniquePtr(coset_offsets_[chunk_index]);
-
-  auto prev_storage = prev_layer_->MakeStorage();
   ASSERT_DEBUG(requested_size == ChunkSize(), "requested_size is bigger than ChunkSize()");
-  auto chunk = prev_layer_->GetChunk(prev_storage.get(), requested_size * 2, chunk_index);
-  folder_.ComputeNextFriLayer(chunk_domain->At(0), chunk, eval_point_, output);
+  FoldChunk(requested_size, chunk_index, output);
 }
 
 FieldElementVector FriLayerProxy::EvalAtPoints(
@@ -23,6 +23,7 @@
 #include "starkware/algebra/fft/fft_with_precompute.h"
 #include "starkware/fri/fri_folder.h"
 #include "starkware/fri/fri_parameters.h"
+#include "starkware/utils/scratch_vector.h"
 
 namespace starkware {
 
@@ -108,6 +109,7 @@ class FriLayerInMemory : public FriLayer {
       Storage* storage, const FieldElementSpan& output, size_t requested_size,
       size_t chunk_index) const override;
 
+  // Get evaluation at specific indices (of the layer evaluation).
   FieldElementVector EvalAtPoints(const gsl::span<uint64_t>& required_indices) const override;
 
   std::unique_ptr<Storage> MakeStorage() const override { return std::make_unique<Storage>(); }
@@ -156,6 +158,34 @@ class FriLayerOutOfMemory : public FriLayer {
   mutable bool is_evaluation_moved_ = false;  // Evaluation cannot use for 1st chunk after LDE init.
 };
 
+/*
+  A layer whose evaluation is stored in a scratch file in --scratch_dir (see ScratchFileMapping).
+  The evaluation is computed once, chunk by chunk, by folding the previous layer directly into the
+  file, so only the chunk which is currently used has to be resident in memory (the OS page cache
+  decides which parts of the file are kept in RAM).
+  The layer is read in chunks of at most max_chunk_bytes bytes.
+*/
+class FriLayerOnScratchFile : public FriLayer {
+ public:
+  FriLayerOnScratchFile(MaybeOwnedPtr<const FriLayer> prev_layer, uint64_t max_chunk_bytes);
+
+  uint64_t ChunkSize() const override { return chunk_size_; }
+  ConstFieldElementSpan GetChunk(
+      Storage* storage, size_t requested_size, size_t chunk_index) const override;
+  void GetChunk(
+      Storage* storage, const FieldElementSpan& output, size_t requested_size,
+      size_t chunk_index) const override;
+
+  FieldElementVector EvalAtPoints(const gsl::span<uint64_t>& required_indices) const override;
+
+  std::unique_ptr<Storage> MakeStorage() const override { return std::make_unique<Storage>(); }
+
+ private:
+  std::unique_ptr<ScratchFileMapping> mapping_;
+  FieldElementSpan evaluation_;  // Points to the data of mapping_.
+  uint64_t chunk_size_;
+};
+
 /*
   A layer which is used as a proxy between layers. The proxy is the only kind of layer which folds
   the domain, so it must be at least one proxy between every two other types of layers.
@@ -166,7 +196,19 @@ class FriLayerProxy : public FriLayer {
 
   FriLayerProxy(
       const FriFolderBase& folder, MaybeOwnedPtr<const FriLayer> prev_layer,
-      FieldElement eval_point, const FriProverConfig* fri_prover_config);
+      FieldElement eval_point, const FriProverConfig* fri_prover_config)
+      : FriLayerProxy(
+            folder, std::move(prev_layer), std::vector<FieldElement>{std::move(eval_point)},
+            fri_prover_config) {}
+
+  /*
+    A proxy which folds the previous layer eval_points.size() times in a single pass (see
+    FriFolderBase::ComputeNextFriLayerMultiStep()). Equivalent to a chain of proxies with the given
+    evaluation points, without computing the layers in between.
+  */
+  FriLayerProxy(
+      const FriFolderBase& folder, MaybeOwnedPtr<const FriLayer> prev_layer,
+      std::vector<FieldElement> eval_points, const FriProverConfig* fri_prover_config);
 
   uint64_t ChunkSize() const override { return chunk_size_; }
   ConstFieldElementSpan GetChunk(
@@ -194,15 +236,20 @@ class FriLayerProxy : public FriLayer {
     FieldElementVector accumulation;
   };
 
-  MaybeOwnedPtr<const FftBases> FoldDomain(const FftBases* domain) {
-    return TakeOwnershipFrom(domain->FromLayerAsUniquePtr(1));
+  static MaybeOwnedPtr<const FftBases> FoldDomain(const FftBases* domain, size_t n_steps) {
+    return TakeOwnershipFrom(domain->FromLayerAsUniquePtr(n_steps));
   }
 
   uint64_t CalculateChunkSize();
 
+  /*
+    Folds the corresponding chunk of the previous layer into output, whose size is requested_size.
+  */
+  void FoldChunk(size_t requested_size, size_t chunk_index, const FieldElementSpan& output) const;
+
   const FriFolderBase& folder_;
   MaybeOwnedPtr<const FriLayer> prev_layer_;
-  const FieldElement eval_point_;
+  const std::vector<FieldElement> eval_points_;
   const FriProverConfig* fri_prover_config_;
   std::unique_ptr<FftBases> coset_bases_;
   std::vector<FieldElement> coset_offsets_;
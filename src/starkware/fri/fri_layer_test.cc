@@ -14,18 +14,24 @@
 
 #include "starkware/fri/fri_layer.h"
 
+#include <string>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "starkware/algebra/lde/lde.h"
+#include "starkware/error_handling/test_utils.h"
 #include "starkware/fri/fri_folder.h"
 #include "starkware/fri/fri_parameters.h"
 #include "starkware/fri/fri_test_utils.h"
+#include "starkware/utils/scratch_vector_test_utils.h"
 
 namespace starkware {
 namespace fri {
 namespace layer {
 namespace {
 
+using testing::HasSubstr;
+
 using TestedFieldTypes = ::testing::Types<TestFieldElement>;
 
 template <typename FieldElementT>
@@ -164,6 +170,32 @@ TYPED_TEST(FriLayerTest, ProxyLayer) {
   EXPECT_EQ(layer_eval, folded_layer);
 }
 
+TYPED_TEST(FriLayerTest, MultiStepProxyLayer) {
+  this->Init();
+  Prng prng;
+  const FieldElement second_eval_point(TypeParam::RandomElement(&prng));
+
+  // The second config splits the first folded layer into chunks.
+  const FriProverConfig chunked_config{
+      /*max_non_chunked_layer_size=*/128,
+      /*n_chunks_between_layers=*/4,
+      FriProverConfig::kAllInMemoryLayers,
+  };
+  for (const FriProverConfig* config : {&this->fri_prover_config_, &chunked_config}) {
+    FriLayerProxy layer_1_proxy(
+        *this->folder_, UseOwned(this->layer_0_out_), *this->eval_point_, config);
+    FriLayerProxy layer_2_proxy(
+        *this->folder_, UseOwned(&layer_1_proxy), second_eval_point, config);
+    FriLayerProxy multi_step_proxy(
+        *this->folder_, UseOwned(this->layer_0_out_),
+        std::vector<FieldElement>{*this->eval_point_, second_eval_point}, config);
+
+    EXPECT_EQ(multi_step_proxy.LayerSize(), layer_2_proxy.LayerSize());
+    EXPECT_EQ(multi_step_proxy.ChunkSize(), layer_2_proxy.ChunkSize());
+    EXPECT_EQ(multi_step_proxy.GetAllEvaluation(), layer_2_proxy.GetAllEvaluation());
+  }
+}
+
 TYPED_TEST(FriLayerTest, OutOfMemoryOverOutOfMemory) {
   this->Init();
   FriLayerOutOfMemory layer_2_out(UseOwned(this->layer_1_proxy_), 256);
@@ -219,6 +251,51 @@ TYPED_TEST(FriLayerTest, InMemory) {
   }
 }
 
+TYPED_TEST(FriLayerTest, OnScratchFile) {
+  this->Init();
+  ScopedScratchDir scratch_dir(::testing::TempDir());
+  FriLayerOnScratchFile layer_2_scratch(UseOwned(this->layer_1_proxy_), 64 * sizeof(TypeParam));
+  EXPECT_EQ(layer_2_scratch.LayerSize(), 512);
+  EXPECT_EQ(layer_2_scratch.ChunkSize(), 64);
+
+  FieldElementVector folded_layer = this->folder_->ComputeNextFriLayer(
+      this->bases_.At(0), this->layer_0_out_->GetAllEvaluation(), *this->eval_point_);
+  EXPECT_EQ(layer_2_scratch.GetAllEvaluation(), folded_layer);
+
+  std::vector<uint64_t> required_row_indices{0, 42, 511};
+  auto evaluation = layer_2_scratch.EvalAtPoints(required_row_indices);
+  for (size_t i = 0; i < required_row_indices.size(); ++i) {
+    EXPECT_EQ(evaluation[i], folded_layer[required_row_indices[i]]);
+  }
+
+  // Fold the layer on the scratch file once more.
+  FriLayerProxy layer_3_proxy(
+      *this->folder_, UseOwned(&layer_2_scratch), *this->eval_point_, &this->fri_prover_config_);
+  EXPECT_EQ(
+      layer_3_proxy.GetAllEvaluation(),
+      this->folder_->ComputeNextFriLayer(this->bases_.At(1), folded_layer, *this->eval_point_));
+}
+
+TYPED_TEST(FriLayerTest, OnScratchFileChunkSize) {
+  this->Init();
+  ScopedScratchDir scratch_dir(::testing::TempDir());
+  // The chunk size is rounded down to a power of two, and is at most the layer size.
+  EXPECT_EQ(FriLayerOnScratchFile(UseOwned(this->layer_1_proxy_), 100 * sizeof(TypeParam))
+                .ChunkSize(),
+            64);
+  EXPECT_EQ(FriLayerOnScratchFile(UseOwned(this->layer_1_proxy_), 1).ChunkSize(), 1);
+  EXPECT_EQ(
+      FriLayerOnScratchFile(UseOwned(this->layer_1_proxy_), uint64_t(1) << 40).ChunkSize(), 512);
+}
+
+TYPED_TEST(FriLayerTest, OnScratchFileRequiresScratchDir) {
+  this->Init();
+  ScopedScratchDir scratch_dir("");
+  EXPECT_ASSERT(
+      FriLayerOnScratchFile(UseOwned(this->layer_1_proxy_), 1024),
+      HasSubstr("requires --scratch_dir"));
+}
+
 TYPED_TEST(FriLayerTest, EvaluationTest) {
   this->Init();
   this->InitMoreLayers();
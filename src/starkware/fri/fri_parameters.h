@@ -106,6 +106,14 @@ struct FriProverConfig {
     Log(Size) of the biggest in memory fri layer - bigger layers are out of memory.
   */
   size_t log_n_max_in_memory_fri_layer_elements;
+
+  /*
+    Memory budget, in bytes, of a single chunk of an out of memory layer.
+    If positive, the out of memory layers (except for the first layer) are stored in scratch files
+    in --scratch_dir (see FriLayerOnScratchFile), and are read in chunks of at most this size.
+    If zero, they are recomputed chunk by chunk from an LDE (see FriLayerOutOfMemory).
+  */
+  uint64_t scratch_layer_chunk_bytes = 0;
 };
 
 }  // namespace starkware
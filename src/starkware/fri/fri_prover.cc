@@ -15,12 +15,14 @@
 #include "starkware/fri/fri_prover.h"
 
 #include <set>
+#include <vector>
 
 #include "starkware/algebra/lde/lde.h"
 #include "starkware/algebra/polymorphic/field_element_vector.h"
 #include "starkware/channel/annotation_scope.h"
 #include "starkware/error_handling/error_handling.h"
 #include "starkware/utils/profiling.h"
+#include "starkware/utils/task_manager.h"
 
 namespace starkware {
 
@@ -47,6 +49,9 @@ MaybeOwnedPtr<const FriLayer> FriProver::CommitmentPhase() {
   ProfilingBlock profiling_block("FRI commit phase");
   size_t basis_index = 0;
   bool first_in_memory = true;
+  const uint64_t scratch_layer_chunk_bytes = fri_prover_config_->scratch_layer_chunk_bytes;
+  // Whether the last out of memory layer is an LDE based layer (FriLayerOutOfMemory).
+  bool is_prev_layer_lde = true;
 
   size_t coset_size = witness_.Size();
   uint64_t in_memory_fri_elements =
@@ -72,7 +77,7 @@ MaybeOwnedPtr<const FriLayer> FriProver::CommitmentPhase() {
     current_layer = CreateNextFriLayer(std::move(current_layer), fri_step, &basis_index);
 
     if (is_in_memory) {
-      if (first_in_memory && fri_step != 0) {
+      if (first_in_memory && fri_step != 0 && is_prev_layer_lde) {
         // Optimize creation of 1st in memory layer by creating out of memory layer just before it.
         // This makes the first LDE smaller.
         coset_size = SafeDiv(coset_size, Pow2(fri_step));
@@ -80,6 +85,11 @@ MaybeOwnedPtr<const FriLayer> FriProver::CommitmentPhase() {
       }
       first_in_memory = false;
       current_layer = UseMovedValue(FriLayerInMemory(std::move(current_layer)));
+    } else if (scratch_layer_chunk_bytes > 0) {
+      // Fold the previous layer chunk by chunk into a scratch file.
+      current_layer = UseMovedValue(
+          FriLayerOnScratchFile(std::move(current_layer), scratch_layer_chunk_bytes));
+      is_prev_layer_lde = false;
     } else {
       coset_size = SafeDiv(coset_size, Pow2(fri_step));
       current_layer = UseMovedValue(FriLayerOutOfMemory(std::move(current_layer), coset_size));
@@ -102,21 +112,24 @@ MaybeOwnedPtr<const FriLayer> FriProver::CommitmentPhase() {
 }
 
 // Generates the next FriLayer.
-// Done by creating middleware proxy layers and returning the last of them.
+// Done by creating a middleware proxy layer, which folds the current layer fri_step times in a
+// single pass.
 MaybeOwnedPtr<const FriLayer> FriProver::CreateNextFriLayer(
     MaybeOwnedPtr<const FriLayer> current_layer, size_t fri_step, size_t* basis_index) {
-  std::optional<FieldElement> eval_point = std::nullopt;
-  if (fri_step != 0) {
-    eval_point = channel_->ReceiveFieldElement(params_->field, "Evaluation point");
+  if (fri_step == 0) {
+    return current_layer;
   }
 
+  FieldElement eval_point = channel_->ReceiveFieldElement(params_->field, "Evaluation point");
+  std::vector<FieldElement> eval_points;
+  eval_points.reserve(fri_step);
   for (size_t j = 0; j < fri_step; j++, (*basis_index)++) {
-    current_layer = UseMovedValue(
-        FriLayerProxy(*folder_, std::move(current_layer), *eval_point, fri_prover_config_.get()));
-    eval_point = params_->fft_bases->ApplyBasisTransform(*eval_point, *basis_index);
+    eval_points.push_back(eval_point);
+    eval_point = params_->fft_bases->ApplyBasisTransform(eval_point, *basis_index);
   }
 
-  return current_layer;
+  return UseMovedValue(FriLayerProxy(
+      *folder_, std::move(current_layer), std::move(eval_points), fri_prover_config_.get()));
 }
 
 void FriProver::SendLastLayer(MaybeOwnedPtr<const FriLayer>&& last_layer) {
@@ -164,10 +177,22 @@ void FriProver::ProveFri() {
   AnnotationScope scope(channel_.get(), "Decommitment");
 
   ProfilingBlock profiling_block("FRI response generation");
-  size_t layer_num = 0;
-  for (auto& layer : committed_layers_) {
-    AnnotationScope scope(channel_.get(), "Layer " + std::to_string(layer_num++));
-    layer->Decommit(queries);
+  // Compute the decommitted values of all the layers in parallel, and only then send them on the
+  // channel, in order. The first layer is decommitted by the callback, which may send data on the
+  // channel, so it is decommitted right away, while the rest of the layers are being prepared.
+  TaskManager::GetInstance().ParallelFor(committed_layers_.size(), [&](const TaskInfo& task_info) {
+    const size_t layer_num = task_info.start_idx;
+    if (layer_num == 0) {
+      AnnotationScope scope(channel_.get(), "Layer 0");
+      committed_layers_[0]->Decommit(queries);
+    } else {
+      committed_layers_[layer_num]->PrepareDecommitment(queries);
+    }
+  });
+
+  for (size_t layer_num = 1; layer_num < committed_layers_.size(); ++layer_num) {
+    AnnotationScope scope(channel_.get(), "Layer " + std::to_string(layer_num));
+    committed_layers_[layer_num]->Decommit(queries);
   }
 }
 
@@ -47,6 +47,7 @@
 #include "starkware/fri/fri_test_utils.h"
 #include "starkware/fri/fri_verifier.h"
 #include "starkware/proof_system/proof_system.h"
+#include "starkware/utils/scratch_vector_test_utils.h"
 
 namespace starkware {
 namespace {
@@ -54,6 +55,8 @@ namespace {
 using starkware::fri::details::TestPolynomial;
 using testing::_;
 using testing::ElementsAre;
+using testing::Expectation;
+using testing::ExpectationSet;
 using testing::HasSubstr;
 using testing::Invoke;
 using testing::MockFunction;
@@ -147,6 +150,7 @@ TYPED_TEST(FriTest, ProverBasicFlowWithMockChannel) {
   TableProverMockFactory table_prover_factory(
       {std::make_tuple(2, 16, 8), std::make_tuple(1, 16, 2)});
   StrictMock<MockFunction<void(const std::vector<uint64_t>& queries)>> first_layer_queries_callback;
+  Expectation queries_chosen;
   {
     testing::InSequence dummy;
 
@@ -177,44 +181,59 @@ TYPED_TEST(FriTest, ProverBasicFlowWithMockChannel) {
     EXPECT_CALL(prover_channel, ApplyProofOfWork(proof_of_work_bits));
 
     // The prover will request two query locations. Answer with 0 and 6.
-    EXPECT_CALL(prover_channel, ReceiveNumberImpl(256)).WillOnce(Return(0)).WillOnce(Return(6));
-    // The verifier requested indices 0 and 6 which refer to the two cosets (0, 1, 2, 3) and (24,
-    // 25, 26, 27) in the first layer (x -> (4 * x, ..., 4 * x + 3)). Hence, the prover will send
-    // data[0], ..., data[3], data[24], ..., data[27] from the top layer.
-    // Handling the first layer is done using a callback to first_layer_queries_callback.
-    EXPECT_CALL(first_layer_queries_callback, Call(ElementsAre(0, 1, 2, 3, 24, 25, 26, 27)));
-
-    // Decommitment phase expectations.
-
-    // As the verifier requested indices 0 and 6 (which refer to (0, 1, 2, 3) and (24, 25, 26,
-    // 27) in the first layer), it will be able to compute the values at indices 0 and 6 of the
-    // second layer of FRI. The prover will additionally send the values at indices 1...5, 7
-    // which will allow the verifier to compute index 0 on the third layer. Then it will send
-    // index 1 of the third layer to allow the verifier to continue to the forth (and last)
-    // layer.
-    // We mock StartDecommitmentPhase() to ask for rows 0,...,9.
-    const std::vector<uint64_t> simulated_requested_rows = {0};
-    EXPECT_CALL(
-        table_prover_factory[0], StartDecommitmentPhase(
-                                     UnorderedElementsAreArray(
-                                         {RowCol(0, 1), RowCol(0, 2), RowCol(0, 3), RowCol(0, 4),
-                                          RowCol(0, 5), RowCol(0, 7)}),
-                                     UnorderedElementsAre(RowCol(0, 0), RowCol(0, 6))))
-        .WillOnce(Return(simulated_requested_rows));
+    queries_chosen = EXPECT_CALL(prover_channel, ReceiveNumberImpl(256))
+                         .WillOnce(Return(0))
+                         .WillOnce(Return(6));
+  }
+
+  // Decommitment phase expectations.
+  // The layers which are committed by the table provers are prepared (StartDecommitmentPhase())
+  // concurrently with the first layer callback, and are decommitted in order after it.
+
+  // The verifier requested indices 0 and 6 which refer to the two cosets (0, 1, 2, 3) and (24,
+  // 25, 26, 27) in the first layer (x -> (4 * x, ..., 4 * x + 3)). Hence, the prover will send
+  // data[0], ..., data[3], data[24], ..., data[27] from the top layer.
+  // Handling the first layer is done using a callback to first_layer_queries_callback.
+  const Expectation first_layer_decommitted =
+      EXPECT_CALL(first_layer_queries_callback, Call(ElementsAre(0, 1, 2, 3, 24, 25, 26, 27)))
+          .After(queries_chosen);
+
+  // As the verifier requested indices 0 and 6 (which refer to (0, 1, 2, 3) and (24, 25, 26,
+  // 27) in the first layer), it will be able to compute the values at indices 0 and 6 of the
+  // second layer of FRI. The prover will additionally send the values at indices 1...5, 7
+  // which will allow the verifier to compute index 0 on the third layer. Then it will send
+  // index 1 of the third layer to allow the verifier to continue to the forth (and last)
+  // layer.
+  // We mock StartDecommitmentPhase() to ask for rows 0,...,9.
+  const std::vector<uint64_t> simulated_requested_rows = {0};
+  ExpectationSet layers_prepared;
+  layers_prepared +=
+      EXPECT_CALL(
+          table_prover_factory[0], StartDecommitmentPhase(
+                                       UnorderedElementsAreArray(
+                                           {RowCol(0, 1), RowCol(0, 2), RowCol(0, 3),
+                                            RowCol(0, 4), RowCol(0, 5), RowCol(0, 7)}),
+                                       UnorderedElementsAre(RowCol(0, 0), RowCol(0, 6))))
+          .After(queries_chosen)
+          .WillOnce(Return(simulated_requested_rows));
+  layers_prepared +=
+      EXPECT_CALL(
+          table_prover_factory[1],
+          StartDecommitmentPhase(
+              UnorderedElementsAre(RowCol(0, 1)), UnorderedElementsAre(RowCol(0, 0))))
+          .After(queries_chosen)
+          .WillOnce(Return(std::vector<uint64_t>{}));
+
+  {
+    testing::InSequence dummy;
     EXPECT_CALL(table_prover_factory[0], Decommit(_))
+        .After(first_layer_decommitted, layers_prepared)
         .WillOnce(Invoke([&](gsl::span<const ConstFieldElementSpan> aa) {
           EXPECT_EQ(aa.size(), 8);
           for (size_t i = 0; i < 8; ++i) {
             EXPECT_EQ(aa[i][0], second_layer[i]);
           }
         }));
-
-    EXPECT_CALL(
-        table_prover_factory[1],
-        StartDecommitmentPhase(
-            UnorderedElementsAre(RowCol(0, 1)), UnorderedElementsAre(RowCol(0, 0))))
-        .WillOnce(Return(std::vector<uint64_t>{}));
-
     EXPECT_CALL(table_prover_factory[1], Decommit(_))
         .WillOnce(Invoke([&](gsl::span<const ConstFieldElementSpan> aa) {
           const FieldElementVector empty_vector = FieldElementVector::Make<FieldElementT>();
@@ -477,8 +496,9 @@ class FriEndToEndTest : public testing::Test {
     FriProver::FirstLayerCallback first_layer_queries_callback =
         [](const std::vector<uint64_t>& /* queries */) {};
 
-    fri_prover_config.log_n_max_in_memory_fri_layer_elements =
-        CalcLogNInMemoryFriElements(witness->Size(), params.fri_step_list);
+    fri_prover_config.log_n_max_in_memory_fri_layer_elements = std::min(
+        CalcLogNInMemoryFriElements(witness->Size(), params.fri_step_list),
+        log_n_max_in_memory_fri_layer_elements);
 
     // Create a FRI proof.
     FriProver fri_prover(
@@ -538,6 +558,8 @@ class FriEndToEndTest : public testing::Test {
   FftBasesDefaultImpl<FieldElementT> bases;
   FriParameters params;
   FriProverConfig fri_prover_config;
+  // An upper bound on fri_prover_config.log_n_max_in_memory_fri_layer_elements.
+  size_t log_n_max_in_memory_fri_layer_elements = FriProverConfig::kAllInMemoryLayers;
   std::optional<FieldElementVector> witness;
   std::vector<FieldElementT> eval_domain_data;
 };
@@ -578,6 +600,22 @@ TYPED_TEST(FriEndToEndTest, NegativeTestLargerDegree) {
   EXPECT_ASSERT(this->GenerateProof(), HasSubstr("Last FRI layer"));
 }
 
+TYPED_TEST(FriEndToEndTest, ScratchFileLayers) {
+  this->InitWitness(this->degree_bound, this->eval_domain_size);
+  const FieldElementVector witness_copy = FieldElementVector::CopyFrom(*this->witness);
+  const std::vector<std::byte> proof = this->GenerateProof();
+
+  // Generate the proof again, where all the layers but the last are out of memory, and all the out
+  // of memory layers (except for the first) are stored in scratch files.
+  ScopedScratchDir scratch_dir(::testing::TempDir());
+  this->witness = FieldElementVector::CopyFrom(witness_copy);
+  this->log_n_max_in_memory_fri_layer_elements = 0;
+  this->fri_prover_config.scratch_layer_chunk_bytes =
+      64 * sizeof(typename TestFixture::FieldElementT);
+  EXPECT_EQ(this->GenerateProof(), proof);
+  EXPECT_TRUE(this->VerifyProof(proof));
+}
+
 TYPED_TEST(FriEndToEndTest, ChangeByte) {
   this->InitWitness(this->degree_bound, this->eval_domain_size);
 
@@ -89,14 +89,8 @@ void FriVerifier::ReadLastLayerCoefficients() {
   std::unique_ptr<FftBases> lde_bases =
       params_->fft_bases->FromLayerAsUniquePtr(last_layer_basis_index);
 
-  std::unique_ptr<LdeManager> last_layer_lde = MakeLdeManager(*lde_bases);
-
-  last_layer_lde->AddFromCoefficients(last_layer_coefficients_vector);
-  expected_last_layer_ = FieldElementVector::MakeUninitialized(params_->field, last_layer_size);
-
-  // Coset offset can be taken as first element in lde_bases.
-  last_layer_lde->EvalOnCoset(
-      lde_bases->At(0).GetFieldElementAt(0), std::vector<FieldElementSpan>{*expected_last_layer_});
+  last_layer_lde_ = MakeLdeManager(*lde_bases);
+  last_layer_lde_->AddFromCoefficients(last_layer_coefficients_vector);
 }
 
 void FriVerifier::VerifyFirstLayer() {
@@ -175,15 +169,34 @@ void FriVerifier::VerifyLastLayer() {
   const size_t fri_step_sum = Sum(params_->fri_step_list);
 
   ASSERT_RELEASE(
-      expected_last_layer_.has_value(), "ReadLastLayer() must be called before VerifyLastLayer().");
+      last_layer_lde_ != nullptr, "ReadLastLayer() must be called before VerifyLastLayer().");
 
   AnnotationScope scope(channel_.get(), "Last Layer");
   const FftDomainBase& basis = params_->fft_bases->At(fri_step_sum);
 
+  // Evaluate the last layer only at the queried points, all in a single batch. point_indices[j] is
+  // the index of the point of query j.
+  FieldElementVector points = FieldElementVector::Make(params_->field);
+  points.Reserve(query_results_.size());
+  std::vector<size_t> point_indices;
+  point_indices.reserve(query_results_.size());
+  uint64_t prev_point_query_index = std::numeric_limits<uint64_t>::max();
+  for (size_t j = 0; j < query_results_.size(); ++j) {
+    const uint64_t query_index = query_indices_[j] >> (fri_step_sum - first_fri_step);
+    if (query_index != prev_point_query_index) {
+      points.PushBack(basis.GetFieldElementAt(query_index));
+      prev_point_query_index = query_index;
+    }
+    point_indices.push_back(points.Size() - 1);
+  }
+  FieldElementVector expected_values =
+      FieldElementVector::MakeUninitialized(params_->field, points.Size());
+  last_layer_lde_->EvalAtPoints(0, points, expected_values);
+
   uint64_t prev_query_index = std::numeric_limits<uint64_t>::max();
   for (size_t j = 0; j < query_results_.size(); ++j) {
     const uint64_t query_index = query_indices_[j] >> (fri_step_sum - first_fri_step);
-    const FieldElement expected_value = expected_last_layer_->At(query_index);
+    const FieldElement expected_value = expected_values[point_indices[j]];
     ASSERT_RELEASE(
         query_results_[j] == expected_value,
         "FRI query #" + std::to_string(j) +
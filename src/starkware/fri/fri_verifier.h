@@ -18,6 +18,7 @@
 #include <memory>
 #include <vector>
 
+#include "starkware/algebra/lde/lde.h"
 #include "starkware/channel/verifier_channel.h"
 #include "starkware/commitment_scheme/table_verifier.h"
 #include "starkware/fri/fri_details.h"
@@ -68,8 +69,7 @@ class FriVerifier {
   void CommitmentPhase();
 
   /*
-    Reads the coefficients of the interpolation polynomial of the last layer and computes
-    expected_last_layer_.
+    Reads the coefficients of the interpolation polynomial of the last layer into last_layer_lde_.
   */
   void ReadLastLayerCoefficients();
 
@@ -79,13 +79,13 @@ class FriVerifier {
     For each of the inner layers (i.e. not the first nor the last), we send the queries through its
     appropriate "channel", and authenticate responses. We go layer-by-layer, resolving all queries
     in parallel. If all is correct - the last layer (not computed in this function) is expected to
-    agree with expected_last_layer_. If a verification on some layer fails, it throws an exception.
+    agree with last_layer_lde_. If a verification on some layer fails, it throws an exception.
   */
   void VerifyInnerLayers();
 
   /*
-    Verifies that the elements of the last layer are consistent with expected_last_layer_.
-    Throws an exception otherwise.
+    Verifies that the elements of the last layer are consistent with last_layer_lde_, by evaluating
+    it at the queried points. Throws an exception otherwise.
   */
   void VerifyLastLayer();
 
@@ -96,7 +96,7 @@ class FriVerifier {
   MaybeOwnedPtr<FirstLayerCallback> first_layer_queries_callback_;
   size_t n_layers_;
 
-  std::optional<FieldElementVector> expected_last_layer_;
+  std::unique_ptr<LdeManager> last_layer_lde_;
   std::optional<FieldElement> first_eval_point_;
   std::vector<FieldElement> eval_points_;
   std::vector<std::unique_ptr<TableVerifier>> table_verifiers_;
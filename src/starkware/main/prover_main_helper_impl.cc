@@ -28,6 +28,7 @@
 #include "starkware/channel/noninteractive_prover_channel.h"
 #include "starkware/crypt_tools/invoke.h"
 #include "starkware/crypt_tools/masked_hash.h"
+#include "starkware/stark/committed_trace.h"
 #include "starkware/stark/stark.h"
 #include "starkware/stark/utils.h"
 #include "starkware/utils/flag_validators.h"
@@ -122,6 +123,12 @@ std::vector<std::byte> ProverMainHelperImpl(
       parameters["n_verifier_friendly_commitment_layers"].HasValue()
           ? parameters["n_verifier_friendly_commitment_layers"].AsUint64()
           : 0;
+  CommittedTraceProver::ValidateConfig(
+      stark_config.cached_lde_config, stark_params.NumCosets(),
+      n_verifier_friendly_commitment_layers);
+
+  const size_t merkle_cap_height =
+      parameters["merkle_cap_height"].HasValue() ? parameters["merkle_cap_height"].AsUint64() : 0;
 
   TableProverFactory table_prover_factory = InvokeByHashFunc(commitment_hash, [&](auto hash_tag) {
     using HashT = typename decltype(hash_tag)::type;
@@ -130,7 +137,8 @@ std::vector<std::byte> ProverMainHelperImpl(
         stark_config.table_prover_n_tasks_per_segment, stark_config.n_out_of_memory_merkle_layers,
         n_verifier_friendly_commitment_layers,
         CommitmentHashes(
-            /*top_hash=*/verifier_friendly_commitment_hash, /*bottom_hash=*/commitment_hash));
+            /*top_hash=*/verifier_friendly_commitment_hash, /*bottom_hash=*/commitment_hash),
+        merkle_cap_height);
   });
 
   AnnotationScope scope(&channel, statement->GetName());
@@ -82,18 +82,23 @@ bool VerifierMainHelperImpl(
             ? parameters["n_verifier_friendly_commitment_layers"].AsUint64()
             : 0;
 
+    const size_t merkle_cap_height = parameters["merkle_cap_height"].HasValue()
+                                         ? parameters["merkle_cap_height"].AsUint64()
+                                         : 0;
+
     TableVerifierFactory table_verifier_factory =
         InvokeByHashFunc(commitment_hash, [&](auto hash_tag) {
           using HashT = typename decltype(hash_tag)::type;
           TableVerifierFactory res = [&channel, n_verifier_friendly_commitment_layers,
-                                      verifier_friendly_commitment_hash, &commitment_hash](
+                                      verifier_friendly_commitment_hash, &commitment_hash,
+                                      merkle_cap_height](
                                          const Field& field, uint64_t n_rows, size_t n_columns) {
             auto commitment_hashes = CommitmentHashes(
                 /*top_hash=*/verifier_friendly_commitment_hash,
                 /*bottom_hash=*/commitment_hash);
             auto packaging_commitment_scheme = MakeCommitmentSchemeVerifier<HashT>(
                 n_columns * field.ElementSizeInBytes(), n_rows, &channel,
-                n_verifier_friendly_commitment_layers, commitment_hashes);
+                n_verifier_friendly_commitment_layers, commitment_hashes, merkle_cap_height);
 
             return std::make_unique<TableVerifierImpl>(
                 field, n_columns, UseMovedValue(std::move(packaging_commitment_scheme)), &channel);
@@ -14,10 +14,13 @@
 
 #include "starkware/stark/committed_trace.h"
 
+#include <array>
 #include <map>
+#include <string>
 
 #include "starkware/algebra/fields/field_operations_helper.h"
 #include "starkware/utils/profiling.h"
+#include "starkware/utils/task_manager.h"
 
 namespace starkware {
 
@@ -53,8 +56,26 @@ CommittedTraceProver::CommittedTraceProver(
     : cached_lde_config_(cached_lde_config),
       evaluation_domain_(std::move(evaluation_domain)),
       n_columns_(n_columns),
+      n_tiles_per_coset_(
+          cached_lde_config_.store_full_lde ? 1 : Pow2(cached_lde_config_.log_n_tiles_per_coset)),
       table_prover_(table_prover_factory(
-          evaluation_domain_->NumCosets(), evaluation_domain_->Group().Size(), n_columns_)) {}
+          evaluation_domain_->NumCosets() * n_tiles_per_coset_,
+          SafeDiv(evaluation_domain_->Group().Size(), n_tiles_per_coset_), n_columns_)) {}
+
+void CommittedTraceProver::ValidateConfig(
+    const CachedLdeManager::Config& cached_lde_config, size_t n_cosets,
+    size_t n_verifier_friendly_commitment_layers) {
+  const size_t log_n_tiles_per_coset =
+      cached_lde_config.store_full_lde ? 0 : cached_lde_config.log_n_tiles_per_coset;
+  const size_t segment_tree_height = SafeLog2(n_cosets) + log_n_tiles_per_coset;
+  ASSERT_RELEASE(
+      n_verifier_friendly_commitment_layers == 0 ||
+          n_verifier_friendly_commitment_layers >= segment_tree_height,
+      "n_verifier_friendly_commitment_layers must be either 0 or at least log2(n_cosets) + "
+      "log_n_tiles_per_coset = " +
+          std::to_string(segment_tree_height) + ". n_verifier_friendly_commitment_layers: " +
+          std::to_string(n_verifier_friendly_commitment_layers));
+}
 
 void CommittedTraceProver::Commit(Trace&& trace, const FftBases& trace_domain, bool bit_reverse) {
   // LDE.
@@ -77,26 +98,82 @@ void CommittedTraceProver::Commit(Trace&& trace, const FftBases& trace_domain, b
 
   lde_->FinalizeAdding();
 
+  if (n_tiles_per_coset_ > 1 && lde_->SupportsEvalOnCosetTile()) {
+    CommitInTiles();
+    table_prover_->Commit();
+    return;
+  }
+
+  // The cosets are committed in order, and then the composition polynomial is evaluated on them,
+  // again starting from the first coset. This lets a bounded LDE cache keep the first cosets.
+  const uint64_t n_cosets = evaluation_domain_->NumCosets();
+  std::vector<uint64_t> coset_order(2 * n_cosets);
+  for (uint64_t i = 0; i < coset_order.size(); ++i) {
+    coset_order[i] = i % n_cosets;
+  }
+  lde_->PrefetchHint(coset_order);
+
+  const uint64_t tile_size = SafeDiv(evaluation_domain_->Group().Size(), n_tiles_per_coset_);
   auto storage = lde_->AllocateStorage();
-  for (uint64_t coset_index = 0; coset_index < evaluation_domain_->NumCosets(); coset_index++) {
+  for (uint64_t coset_index = 0; coset_index < n_cosets; coset_index++) {
     ProfilingBlock lde_block("LDE");
     // Compute the LDE.
     auto lde_evaluations = lde_->EvalOnCoset(coset_index, storage.get());
     lde_block.CloseBlock();
     // Commit to the LDE.
     ProfilingBlock commit_to_lde_block("Commit to LDE");
-    table_prover_->AddSegmentForCommitment(
-        {lde_evaluations->begin(), lde_evaluations->end()}, coset_index);
+    for (uint64_t tile_index = 0; tile_index < n_tiles_per_coset_; ++tile_index) {
+      std::vector<ConstFieldElementSpan> tile;
+      tile.reserve(n_columns_);
+      for (const auto& column : *lde_evaluations) {
+        tile.push_back(ConstFieldElementSpan(column).SubSpan(tile_index * tile_size, tile_size));
+      }
+      table_prover_->AddSegmentForCommitment(tile, coset_index * n_tiles_per_coset_ + tile_index);
+    }
     commit_to_lde_block.CloseBlock();
   }
 
   table_prover_->Commit();
 }
 
+void CommittedTraceProver::CommitInTiles() {
+  const Field field = evaluation_domain_->GetField();
+  const uint64_t tile_size = SafeDiv(evaluation_domain_->Group().Size(), n_tiles_per_coset_);
+  const uint64_t n_tiles = evaluation_domain_->NumCosets() * n_tiles_per_coset_;
+
+  // Two tile buffers: one is committed while the next tile is computed into the other.
+  std::array<std::vector<FieldElementVector>, 2> buffers;
+  for (auto& buffer : buffers) {
+    buffer.reserve(n_columns_);
+    for (size_t i = 0; i < n_columns_; ++i) {
+      buffer.push_back(FieldElementVector::MakeUninitialized(field, tile_size));
+    }
+  }
+  const auto eval_tile = [&](uint64_t tile) {
+    std::vector<FieldElementVector>& buffer = buffers[tile % 2];
+    lde_->EvalOnCosetTile(
+        tile / n_tiles_per_coset_, tile % n_tiles_per_coset_,
+        std::vector<FieldElementSpan>(buffer.begin(), buffer.end()));
+  };
+
+  ProfilingBlock lde_and_commit_block("LDE and commit in tiles");
+  eval_tile(0);
+  for (uint64_t tile = 0; tile < n_tiles; ++tile) {
+    const std::vector<FieldElementVector>& current = buffers[tile % 2];
+    TaskManager::GetInstance().ParallelFor(2, [&](const TaskInfo& task_info) {
+      if (task_info.start_idx == 0) {
+        table_prover_->AddSegmentForCommitment({current.begin(), current.end()}, tile);
+      } else if (tile + 1 < n_tiles) {
+        eval_tile(tile + 1);
+      }
+    });
+  }
+}
+
 /*
   The queries are tuples of (coset_index, offset, column_index).
 */
-void CommittedTraceProver::DecommitQueries(
+CommittedTraceProverBase::PreparedDecommitment CommittedTraceProver::PrepareDecommitment(
     gsl::span<const std::tuple<uint64_t, uint64_t, size_t>> queries) const {
   const Field field = evaluation_domain_->GetField();
   const uint64_t trace_length = evaluation_domain_->Group().Size();
@@ -115,16 +192,21 @@ void CommittedTraceProver::DecommitQueries(
       table_prover_->StartDecommitmentPhase(data_queries, {});
 
   // Prepare storage for the requested rows.
-  std::vector<FieldElementVector> elements_data;
+  PreparedDecommitment prepared;
+  std::vector<FieldElementVector>& elements_data = prepared.elements_data;
   elements_data.reserve(NumColumns());
   for (size_t i = 0; i < NumColumns(); i++) {
     elements_data.push_back(FieldElementVector::MakeUninitialized(field, rows_to_fetch.size()));
   }
 
   AnswerQueries(rows_to_fetch, &elements_data);
+  return prepared;
+}
 
-  table_prover_->Decommit(
-      std::vector<ConstFieldElementSpan>{elements_data.begin(), elements_data.end()});
+void CommittedTraceProver::Decommit(const PreparedDecommitment& prepared) const {
+  ASSERT_RELEASE(prepared.elements_data.size() == NumColumns(), "Wrong number of columns");
+  table_prover_->Decommit(std::vector<ConstFieldElementSpan>{
+      prepared.elements_data.begin(), prepared.elements_data.end()});
 }
 
 void CommittedTraceProver::EvalMaskAtPoint(
@@ -135,35 +217,23 @@ void CommittedTraceProver::EvalMaskAtPoint(
 
   ASSERT_RELEASE(mask.size() == output.Size(), "Wrong output size");
 
-  // A map from column index to pairs (mask_row_offset, mask_index).
-  std::map<uint64_t, std::vector<std::pair<int64_t, size_t>>> columns;
-  for (size_t mask_index = 0; mask_index < mask.size(); ++mask_index) {
-    const auto& [row_offset, column_index] = mask[mask_index];
+  // Compute the points to evaluate at, one for each distinct row offset, and the pairs
+  // (column_index, point_index) to evaluate, in the order of the mask.
+  std::map<int64_t, size_t> row_offset_to_point_index;
+  FieldElementVector points = FieldElementVector::Make(field);
+  std::vector<std::pair<size_t, size_t>> column_and_point_indices;
+  column_and_point_indices.reserve(mask.size());
+  for (const auto& [row_offset, column_index] : mask) {
     ASSERT_RELEASE(row_offset >= 0, "EvalMaskAtPoint() does not support negative mask rows");
-    columns[column_index].emplace_back(row_offset, mask_index);
-  }
-
-  for (const auto& [column_index, offsets] : columns) {
-    // Compute points to evaluate at.
-    FieldElementVector points = FieldElementVector::Make(field);
-    points.Reserve(offsets.size());
-    for (const auto& offset_pair : offsets) {
-      const int64_t row_offset = offset_pair.first;
+    const auto [it, inserted] = row_offset_to_point_index.emplace(row_offset, points.Size());
+    if (inserted) {
       points.PushBack(point * trace_gen.Pow(row_offset));
     }
-
-    // Allocate output.
-    FieldElementVector column_output = FieldElementVector::MakeUninitialized(field, offsets.size());
-
-    // Evaluate.
-    lde_->EvalAtPointsNotCached(column_index, points, column_output);
-
-    // Place outputs at correct place.
-    for (size_t i = 0; i < offsets.size(); ++i) {
-      const size_t mask_index = offsets[i].second;
-      output.Set(mask_index, column_output.At(i));
-    }
+    column_and_point_indices.emplace_back(column_index, it->second);
   }
+
+  // Evaluate all the columns together.
+  lde_->EvalAtPointsNotCached(column_and_point_indices, points, output);
 }
 
 /*void CommittedTraceProver::EvalMaskAtPoint(
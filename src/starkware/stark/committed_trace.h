@@ -53,13 +53,37 @@ class CommittedTraceProverBase {
   virtual void Commit(Trace&& trace, const FftBases& trace_domain, bool bit_reverse) = 0;
 
   /*
-    Given queries for the commitment, computes the relevant commitment leaves from the LDE, and
-    decommits them. queries is a list of tuples (coset_index, offset, column_index) for the elements
-    that need to be decommitted.
+    The commitment rows that a decommitment opens, evaluated from the LDE. elements_data holds one
+    FieldElementVector per column.
+  */
+  struct PreparedDecommitment {
+    std::vector<FieldElementVector> elements_data;
+  };
+
+  /*
+    First step of DecommitQueries(): computes the relevant commitment leaves from the LDE, without
+    sending anything on the channel. queries is a list of tuples (coset_index, offset,
+    column_index) for the elements that need to be decommitted.
+    The decommitments of several traces may be prepared concurrently, as long as each of them is
+    followed by a call to Decommit() on the same trace, in the order of the proof.
   */
-  virtual void DecommitQueries(
+  virtual PreparedDecommitment PrepareDecommitment(
       gsl::span<const std::tuple<uint64_t, uint64_t, size_t>> queries) const = 0;
 
+  /*
+    Second step of DecommitQueries(): sends the decommitment of the rows computed by
+    PrepareDecommitment() on the channel.
+  */
+  virtual void Decommit(const PreparedDecommitment& prepared) const = 0;
+
+  /*
+    Given queries for the commitment, computes the relevant commitment leaves from the LDE, and
+    decommits them. See PrepareDecommitment().
+  */
+  void DecommitQueries(gsl::span<const std::tuple<uint64_t, uint64_t, size_t>> queries) const {
+    Decommit(PrepareDecommitment(queries));
+  }
+
   /*
     Computes the mask of the trace columns at a point.
     WARNING: This function introduces overheads (polymorphism), and should not be used at
@@ -89,14 +113,26 @@ class CommittedTraceProver : public CommittedTraceProverBase {
       MaybeOwnedPtr<const ListOfCosetsBase> evaluation_domain, size_t n_columns,
       const TableProverFactory& table_prover_factory);
 
+  /*
+    Asserts that a table prover committing on n_cosets cosets with the given config can be built
+    with n_verifier_friendly_commitment_layers. The table prover commits on each tile of each coset
+    as a separate segment (see CachedLdeManager::Config::log_n_tiles_per_coset), and the top
+    layers of the Merkle tree, above the segments, must all use the same hash.
+  */
+  static void ValidateConfig(
+      const CachedLdeManager::Config& cached_lde_config, size_t n_cosets,
+      size_t n_verifier_friendly_commitment_layers);
+
   size_t NumColumns() const override { return n_columns_; }
   CachedLdeManager* GetLde() override { return lde_.get(); }
 
   void Commit(Trace&& trace, const FftBases& trace_domain, bool bit_reverse) override;
 
-  void DecommitQueries(
+  PreparedDecommitment PrepareDecommitment(
       gsl::span<const std::tuple<uint64_t, uint64_t, size_t>> queries) const override;
 
+  void Decommit(const PreparedDecommitment& prepared) const override;
+
   void EvalMaskAtPoint(
       gsl::span<const std::pair<int64_t, uint64_t>> mask, const FieldElement& point,
       const FieldElementSpan& output) const override;
@@ -116,10 +152,22 @@ class CommittedTraceProver : public CommittedTraceProverBase {
   void AnswerQueries(
       const std::vector<uint64_t>& rows_to_fetch, std::vector<FieldElementVector>* output) const;
 
+  /*
+    Commits on the LDE tile by tile (see CachedLdeManager::Config::log_n_tiles_per_coset), without
+    computing entire cosets. The next tile is computed while the current one is being committed.
+  */
+  void CommitInTiles();
+
   CachedLdeManager::Config cached_lde_config_;
   std::unique_ptr<CachedLdeManager> lde_;
   MaybeOwnedPtr<const ListOfCosetsBase> evaluation_domain_;
   size_t n_columns_;
+
+  /*
+    Each coset is committed as n_tiles_per_coset_ consecutive segments of the table prover. This
+    does not change the commitment.
+  */
+  uint64_t n_tiles_per_coset_;
   std::unique_ptr<TableProver> table_prover_;
 };
 
@@ -38,7 +38,9 @@ class CommittedTraceProverMock : public CommittedTraceProverBase {
   }
   MOCK_METHOD3(Commit_rvr, void(const Trace&, const FftBases&, bool));
   MOCK_CONST_METHOD1(
-      DecommitQueries, void(gsl::span<const std::tuple<uint64_t, uint64_t, size_t>>));
+      PrepareDecommitment,
+      PreparedDecommitment(gsl::span<const std::tuple<uint64_t, uint64_t, size_t>>));
+  MOCK_CONST_METHOD1(Decommit, void(const PreparedDecommitment&));
   MOCK_CONST_METHOD3(
       EvalMaskAtPoint, void(
                            gsl::span<const std::pair<int64_t, uint64_t>>, const FieldElement&,
@@ -25,6 +25,7 @@
 #include "starkware/error_handling/test_utils.h"
 #include "starkware/stark/test_utils.h"
 #include "starkware/stark/utils.h"
+#include "starkware/stl_utils/containers.h"
 
 namespace starkware {
 namespace {
@@ -32,10 +33,12 @@ namespace {
 template <typename FieldElementT>
 void TestEndToEnd(
     const CachedLdeManager::Config& config, MultiplicativeGroupOrdering order,
-    bool verify_decommit_in_base_field = false) {
+    bool verify_decommit_in_base_field = false, size_t n_verifier_friendly_commitment_layers = 0) {
   SCOPED_TRACE(
       "config = {" + std::to_string(config.store_full_lde) + "," +
-      std::to_string(config.use_fft_for_eval) + ", order = " +
+      std::to_string(config.use_fft_for_eval) + "," +
+      std::to_string(config.log_n_tiles_per_coset) + "," +
+      std::to_string(config.max_cache_bytes) + "}, order = " +
       (order == MultiplicativeGroupOrdering::kNaturalOrder ? "Natural order"
                                                            : "Bit reversed order"));
   Prng prng;
@@ -48,8 +51,8 @@ void TestEndToEnd(
   const size_t mask_size = 12;
   const size_t n_out_of_memory_merkle_layers = 0;
   // n_verifier_friendly_commitment_layers should either be 0 or be at least in the height of the
-  // Merkle tree that is its leaves are the segments (cosets) roots.
-  const size_t n_verifier_friendly_commitment_layers = 0;
+  // Merkle tree that is its leaves are the segments (tiles of the cosets) roots.
+  CommittedTraceProver::ValidateConfig(config, n_cosets, n_verifier_friendly_commitment_layers);
 
   ListOfCosets evaluation_domain(
       ListOfCosets::MakeListOfCosets(trace_length, n_cosets, field, order));
@@ -118,7 +121,8 @@ void TestEndToEnd(
   NoninteractiveVerifierChannel verifier_channel(channel_prng.Clone(), prover_channel.GetProof());
   verifier_channel.SetExpectedAnnotations(prover_channel.GetAnnotations());
   TableVerifierFactory table_verifier_factory =
-      [&verifier_channel](const Field& field, uint64_t n_rows, uint64_t n_columns) {
+      [&verifier_channel, n_verifier_friendly_commitment_layers](
+          const Field& field, uint64_t n_rows, uint64_t n_columns) {
         return MakeTableVerifier<Keccak256, FieldElementT>(
             field, n_rows, n_columns, &verifier_channel, n_verifier_friendly_commitment_layers,
             CommitmentHashes(Keccak256::HashName()));
@@ -162,6 +166,17 @@ TEST(CommittedTraceProver, Basic) {
   TestEndToEnd<TestFieldElement>({false, true}, MultiplicativeGroupOrdering::kBitReversedOrder);
   TestEndToEnd<TestFieldElement>({true, true}, MultiplicativeGroupOrdering::kBitReversedOrder);
 
+  // Commit in tiles. For natural order, the cosets are computed as a whole and committed in tiles.
+  TestEndToEnd<TestFieldElement>({false, false, 1}, MultiplicativeGroupOrdering::kNaturalOrder);
+  TestEndToEnd<TestFieldElement>({false, false, 1}, MultiplicativeGroupOrdering::kBitReversedOrder);
+  TestEndToEnd<TestFieldElement>({false, true, 1}, MultiplicativeGroupOrdering::kBitReversedOrder);
+
+  // A bounded LDE cache, with room for a few of the cosets.
+  TestEndToEnd<TestFieldElement>(
+      {false, false, 0, 1024}, MultiplicativeGroupOrdering::kNaturalOrder);
+  TestEndToEnd<TestFieldElement>(
+      {false, true, 0, 1024}, MultiplicativeGroupOrdering::kBitReversedOrder);
+
   // When verify_decommit_in_base_field is true the verifier expects the trace to be generated in
   // the base field (and not in the extension field, as done in the test), hence an exception should
   // be thrown. When verify_decommit_in_base_field is false, the decommit should pass.
@@ -173,5 +188,73 @@ TEST(CommittedTraceProver, Basic) {
       /*verify_decommit_in_base_field=*/false);
 }
 
+TEST(CommittedTraceProver, CommitInTilesWithVerifierFriendlyLayers) {
+  // There are 8 cosets of 16 rows, so with 2 tiles per coset the Merkle tree above the segments is
+  // of height 4, and the whole tree is of height 8.
+  for (const size_t n_verifier_friendly_commitment_layers : {4, 6, 8, 100}) {
+    SCOPED_TRACE(
+        "n_verifier_friendly_commitment_layers = " +
+        std::to_string(n_verifier_friendly_commitment_layers));
+    TestEndToEnd<TestFieldElement>(
+        {false, false, 1}, MultiplicativeGroupOrdering::kBitReversedOrder,
+        /*verify_decommit_in_base_field=*/false, n_verifier_friendly_commitment_layers);
+    TestEndToEnd<TestFieldElement>(
+        {false, true, 1}, MultiplicativeGroupOrdering::kNaturalOrder,
+        /*verify_decommit_in_base_field=*/false, n_verifier_friendly_commitment_layers);
+  }
+
+  // Without tiles, 3 verifier friendly layers cover the tree above the cosets, but not the tree
+  // above the tiles.
+  CommittedTraceProver::ValidateConfig({false, false, 0}, /*n_cosets=*/8, 3);
+  CommittedTraceProver::ValidateConfig({true, false, 1}, /*n_cosets=*/8, 3);
+  EXPECT_ASSERT(
+      CommittedTraceProver::ValidateConfig({false, false, 1}, /*n_cosets=*/8, 3),
+      testing::HasSubstr("at least log2(n_cosets) + log_n_tiles_per_coset = 4"));
+}
+
+/*
+  Returns the proof generated by committing on a random trace with the given config.
+*/
+std::vector<std::byte> CommitmentProof(
+    const CachedLdeManager::Config& config, MultiplicativeGroupOrdering order) {
+  using FieldElementT = TestFieldElement;
+  Prng prng(MakeByteArray<0xca, 0xfe, 0xca, 0xfe>());
+  const size_t trace_length = 64;
+  const size_t n_cosets = 4;
+  const size_t n_columns = 5;
+  ListOfCosets evaluation_domain(ListOfCosets::MakeListOfCosets(
+      trace_length, n_cosets, Field::Create<FieldElementT>(), order));
+
+  NoninteractiveProverChannel prover_channel(
+      Prng(MakeByteArray<0x0, 0x0, 0x0, 0x0>()).Clone());
+  TableProverFactory table_prover_factory = GetTableProverFactory<Keccak256>(
+      &prover_channel, FieldElementT::SizeInBytes(),
+      /*table_prover_n_tasks_per_segment*/ 4, /*n_out_of_memory_merkle_layers=*/0,
+      /*n_verifier_friendly_commitment_layers=*/0, CommitmentHashes(Keccak256::HashName()));
+
+  std::vector<std::vector<FieldElementT>> trace_columns;
+  for (size_t i = 0; i < n_columns; ++i) {
+    trace_columns.push_back(prng.RandomFieldElementVector<FieldElementT>(trace_length));
+  }
+  CommittedTraceProver ctrace_prover(
+      config, UseOwned(&evaluation_domain), n_columns, table_prover_factory);
+  ctrace_prover.Commit(Trace(std::move(trace_columns)), evaluation_domain.Bases(), false);
+  ctrace_prover.DecommitQueries(std::vector<std::tuple<uint64_t, uint64_t, size_t>>{
+      {0, 0, 0}, {1, 17, 3}, {3, 63, 4}});
+  return prover_channel.GetProof();
+}
+
+TEST(CommittedTraceProver, CommitInTilesGivesSameProof) {
+  for (const auto order : {MultiplicativeGroupOrdering::kNaturalOrder,
+                           MultiplicativeGroupOrdering::kBitReversedOrder}) {
+    const std::vector<std::byte> expected = CommitmentProof({false, false}, order);
+    for (size_t log_n_tiles_per_coset = 1; log_n_tiles_per_coset <= 3; ++log_n_tiles_per_coset) {
+      EXPECT_EQ(CommitmentProof({false, false, log_n_tiles_per_coset}, order), expected);
+    }
+    // Tiles are not used when the full LDE is stored.
+    EXPECT_EQ(CommitmentProof({true, false, 2}, order), expected);
+  }
+}
+
 }  // namespace
 }  // namespace starkware
@@ -14,10 +14,13 @@
 
 #include "starkware/stark/composition_oracle.h"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 
 #include "starkware/channel/annotation_scope.h"
 #include "starkware/utils/profiling.h"
+#include "starkware/utils/task_manager.h"
 
 namespace starkware {
 
@@ -110,7 +113,8 @@ CompositionOracleProver::CompositionOracleProver(
       composition_polynomial_(std::move(composition_polynomial)),
       channel_(channel) {}
 
-FieldElementVector CompositionOracleProver::EvalComposition(uint64_t task_size) const {
+FieldElementVector CompositionOracleProver::EvalComposition(
+    uint64_t task_size, size_t n_cosets_per_batch) const {
   const Field field = evaluation_domain_->CosetsOffsets()[0].GetField();
   const uint64_t trace_length = evaluation_domain_->Group().Size();
   const size_t n_segments = ConstraintsDegreeBound();
@@ -120,70 +124,180 @@ FieldElementVector CompositionOracleProver::EvalComposition(uint64_t task_size)
   auto evaluation =
       FieldElementVector::MakeUninitialized(field, composition_polynomial_->GetDegreeBound());
 
-  std::vector<std::unique_ptr<std::vector<FieldElementVector>>> storages;
+  std::vector<uint64_t> coset_order(n_segments);
+  std::iota(coset_order.begin(), coset_order.end(), 0);
+
+  // If n_cosets_per_batch is 1, the cosets are evaluated in a pipeline: while the composition
+  // polynomial is evaluated on one coset, the traces are evaluated on the next one. Hence, two sets
+  // of buffers are used alternately. Otherwise, the traces are evaluated on a batch of cosets, each
+  // into its own set of buffers, and then the composition polynomial is evaluated on all of them in
+  // a single parallel loop.
+  ASSERT_RELEASE(n_cosets_per_batch > 0, "n_cosets_per_batch must be positive.");
+  const bool pipelined = n_cosets_per_batch == 1;
+  const size_t n_buffers = std::min<size_t>(n_segments, pipelined ? 2 : n_cosets_per_batch);
+  std::vector<std::vector<std::unique_ptr<std::vector<FieldElementVector>>>> storages(n_buffers);
   size_t n_cached_columns = 0;
-  storages.reserve(traces_.size());
   for (const auto& trace : traces_) {
-    storages.emplace_back(trace->GetLde()->AllocateStorage());
+    trace->GetLde()->PrefetchHint(coset_order);
+    for (size_t buffer_idx = 0; buffer_idx < n_buffers; ++buffer_idx) {
+      storages[buffer_idx].emplace_back(trace->GetLde()->AllocateStorage());
+    }
     if (trace->GetLde()->IsCached()) {
       n_cached_columns += trace->NumColumns();
     }
   }
 
-  // Allocate storage for bit reversal.
+  // Allocate storage for bit reversal, unless the composition polynomial consumes the columns in
+  // the order in which the LDE manager evaluates them.
+  const bool bit_reversed_input = composition_polynomial_->SupportsBitReversedInput();
   const size_t n_total_columns = Sum(GetWidths(traces_));
 
-  std::vector<FieldElementVector> bitrev_storages;
-  bitrev_storages.reserve(n_cached_columns);
-  for (size_t i = 0; i < n_cached_columns; ++i) {
-    bitrev_storages.emplace_back(FieldElementVector::MakeUninitialized(field, trace_length));
+  std::vector<std::vector<FieldElementVector>> bitrev_storages(n_buffers);
+  if (!bit_reversed_input) {
+    for (auto& buffer_bitrev_storages : bitrev_storages) {
+      buffer_bitrev_storages.reserve(n_cached_columns);
+      for (size_t i = 0; i < n_cached_columns; ++i) {
+        buffer_bitrev_storages.emplace_back(
+            FieldElementVector::MakeUninitialized(field, trace_length));
+      }
+    }
   }
 
-  const size_t log_n_cosets = SafeLog2(evaluation_domain_->NumCosets());
-  for (uint64_t coset_index = 0; coset_index < n_segments; coset_index++) {
+  // Evaluates all traces at the coset, into the buffers of buffer_idx.
+  std::vector<std::vector<ConstFieldElementSpan>> all_evals(n_buffers);
+  const auto eval_traces_on_coset = [&](uint64_t coset_index, size_t buffer_idx) {
+    auto& coset_storages = storages[buffer_idx];
+    auto& coset_bitrev_storages = bitrev_storages[buffer_idx];
+    auto& coset_evals = all_evals[buffer_idx];
     size_t bitrev_storage_index = 0;
-    std::vector<ConstFieldElementSpan> all_evals;
-    all_evals.reserve(n_total_columns);
+    coset_evals.clear();
+    coset_evals.reserve(n_total_columns);
 
-    // Evaluate all traces at the coset.
     for (size_t trace_idx = 0; trace_idx < traces_.size(); ++trace_idx) {
       ProfilingBlock profiling_lde_block("LDE2");
       const std::vector<FieldElementVector>* coset_columns_eval =
-          traces_[trace_idx]->GetLde()->EvalOnCoset(coset_index, storages[trace_idx].get());
+          traces_[trace_idx]->GetLde()->EvalOnCoset(coset_index, coset_storages[trace_idx].get());
       profiling_lde_block.CloseBlock();
+      // A coset in the bounded cache of the LDE (see CachedLdeManager::Config) must not be
+      // modified, and is only valid until the next coset is evaluated.
+      const bool in_bounded_cache = coset_columns_eval != coset_storages[trace_idx].get() &&
+                                    !traces_[trace_idx]->GetLde()->IsCached();
+
+      if (bit_reversed_input) {
+        if (in_bounded_cache && n_buffers > 1) {
+          for (size_t col_idx = 0; col_idx < coset_columns_eval->size(); ++col_idx) {
+            coset_storages[trace_idx]->at(col_idx).AsSpan().CopyDataFrom(
+                coset_columns_eval->at(col_idx));
+          }
+          coset_columns_eval = coset_storages[trace_idx].get();
+        }
+        coset_evals.insert(
+            coset_evals.end(), coset_columns_eval->begin(), coset_columns_eval->end());
+        continue;
+      }
 
       ProfilingBlock profiling_block("BitReversal of columns");
       for (size_t col_idx = 0; col_idx < coset_columns_eval->size(); ++col_idx) {
         if (traces_[trace_idx]->GetLde()->IsCached()) {
           ASSERT_RELEASE(
-              bitrev_storage_index < bitrev_storages.size(), "Not enough bitrev storages");
-          BitReverseVector(coset_columns_eval->at(col_idx), bitrev_storages[bitrev_storage_index]);
-          all_evals.emplace_back(bitrev_storages[bitrev_storage_index++]);
+              bitrev_storage_index < coset_bitrev_storages.size(), "Not enough bitrev storages");
+          BitReverseVector(
+              coset_columns_eval->at(col_idx), coset_bitrev_storages[bitrev_storage_index]);
+          coset_evals.emplace_back(coset_bitrev_storages[bitrev_storage_index++]);
+        } else if (in_bounded_cache) {
+          BitReverseVector(coset_columns_eval->at(col_idx), coset_storages[trace_idx]->at(col_idx));
+          coset_evals.emplace_back(coset_storages[trace_idx]->at(col_idx));
         } else {
-          BitReverseInPlace(storages[trace_idx]->at(col_idx));
-          all_evals.emplace_back(storages[trace_idx]->at(col_idx));
+          BitReverseInPlace(coset_storages[trace_idx]->at(col_idx));
+          coset_evals.emplace_back(coset_storages[trace_idx]->at(col_idx));
         }
       }
     }
+  };
 
+  const size_t log_n_cosets = SafeLog2(evaluation_domain_->NumCosets());
+  const auto eval_composition_on_coset = [&](uint64_t coset_index, size_t buffer_idx) {
     const size_t coset_natural_index = BitReverse(coset_index, log_n_cosets);
     const FieldElement coset_offset = evaluation_domain_->CosetsOffsets()[coset_natural_index];
+    const FieldElementSpan coset_evaluation =
+        evaluation.AsSpan().SubSpan(coset_index * trace_length, trace_length);
     ProfilingBlock composition_block("Actual point-wise computation");
-    composition_polynomial_->EvalOnCosetBitReversedOutput(
-        coset_offset, all_evals,
-        evaluation.AsSpan().SubSpan(coset_index * trace_length, trace_length), task_size);
+    if (bit_reversed_input) {
+      composition_polynomial_->EvalOnCosetBitReversedInputAndOutput(
+          coset_offset, all_evals[buffer_idx], coset_evaluation, task_size);
+    } else {
+      composition_polynomial_->EvalOnCosetBitReversedOutput(
+          coset_offset, all_evals[buffer_idx], coset_evaluation, task_size);
+    }
+  };
+
+  if (!pipelined) {
+    for (uint64_t batch_start = 0; batch_start < n_segments; batch_start += n_buffers) {
+      const size_t batch_size = std::min<size_t>(n_buffers, n_segments - batch_start);
+      std::vector<FieldElement> coset_offsets;
+      std::vector<FieldElementSpan> coset_evaluations;
+      coset_offsets.reserve(batch_size);
+      coset_evaluations.reserve(batch_size);
+      for (size_t buffer_idx = 0; buffer_idx < batch_size; ++buffer_idx) {
+        const uint64_t coset_index = batch_start + buffer_idx;
+        eval_traces_on_coset(coset_index, buffer_idx);
+        coset_offsets.push_back(
+            evaluation_domain_->CosetsOffsets()[BitReverse(coset_index, log_n_cosets)]);
+        coset_evaluations.push_back(
+            evaluation.AsSpan().SubSpan(coset_index * trace_length, trace_length));
+      }
+
+      ProfilingBlock composition_block("Actual point-wise computation");
+      if (bit_reversed_input) {
+        TaskManager::GetInstance().ParallelFor(batch_size, [&](const TaskInfo& task_info) {
+          const size_t buffer_idx = task_info.start_idx;
+          composition_polynomial_->EvalOnCosetBitReversedInputAndOutput(
+              coset_offsets[buffer_idx], all_evals[buffer_idx], coset_evaluations[buffer_idx],
+              task_size);
+        });
+      } else {
+        composition_polynomial_->EvalOnCosetsBitReversedOutput(
+            coset_offsets, gsl::make_span(all_evals).first(batch_size), coset_evaluations,
+            task_size);
+      }
+    }
+    return evaluation;
+  }
+
+  if (n_segments > 0) {
+    eval_traces_on_coset(0, 0);
+  }
+  for (uint64_t coset_index = 0; coset_index < n_segments; coset_index++) {
+    const size_t buffer_idx = coset_index % n_buffers;
+    if (coset_index + 1 == n_segments) {
+      eval_composition_on_coset(coset_index, buffer_idx);
+      break;
+    }
+    TaskManager::GetInstance().ParallelFor(2, [&](const TaskInfo& task_info) {
+      if (task_info.start_idx == 0) {
+        eval_composition_on_coset(coset_index, buffer_idx);
+      } else {
+        eval_traces_on_coset(coset_index + 1, (coset_index + 1) % n_buffers);
+      }
+    });
   }
   return evaluation;
 }
 
 void CompositionOracleProver::DecommitQueries(
     const std::vector<std::pair<uint64_t, uint64_t>>& queries) const {
-  for (size_t trace_i = 0; trace_i < traces_.size(); ++trace_i) {
-    AnnotationScope scope(channel_, "Trace " + std::to_string(trace_i));
+  // Compute the leaves of all the traces in parallel. This does not interact with the channel.
+  std::vector<CommittedTraceProverBase::PreparedDecommitment> prepared(traces_.size());
+  TaskManager::GetInstance().ParallelFor(traces_.size(), [&](const TaskInfo& task_info) {
+    const size_t trace_i = task_info.start_idx;
     const auto trace_queries =
         QueriesToTraceQueries(queries, split_masks_[trace_i], evaluation_domain_->Group().Size());
+    prepared[trace_i] = traces_[trace_i]->PrepareDecommitment(trace_queries);
+  });
 
-    traces_[trace_i]->DecommitQueries(trace_queries);
+  for (size_t trace_i = 0; trace_i < traces_.size(); ++trace_i) {
+    AnnotationScope scope(channel_, "Trace " + std::to_string(trace_i));
+    traces_[trace_i]->Decommit(prepared[trace_i]);
   }
 }
 
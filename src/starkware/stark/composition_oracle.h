@@ -55,12 +55,19 @@ class CompositionOracleProver {
 
     The evaluation is done in task_size tasks. This is forwarded to the composition polynomial
     EvalOnCosetBitReversedOutput, see more info there.
+
+    If n_cosets_per_batch is larger than 1, the traces are evaluated on that many cosets at a time,
+    and the tasks of all the cosets of a batch are scheduled together (see
+    CompositionPolynomial::EvalOnCosetsBitReversedOutput()). This uses n_cosets_per_batch copies of
+    the trace LDE buffers instead of 2, and keeps more threads busy when the cosets are small.
   */
-  FieldElementVector EvalComposition(uint64_t task_size) const;
+  FieldElementVector EvalComposition(uint64_t task_size, size_t n_cosets_per_batch = 1) const;
 
   /*
     Given queries for the virtual oracle, decommits the correct values from the traces to prove the
     virtual oracle values at these queries.
+    The leaves of all the traces are computed concurrently, before any of them is sent on the
+    channel; the decommitments are then sent trace by trace.
   */
   void DecommitQueries(const std::vector<std::pair<uint64_t, uint64_t>>& queries) const;
 
@@ -15,6 +15,7 @@
 #include "starkware/stark/composition_oracle.h"
 
 #include <memory>
+#include <string>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -30,11 +31,15 @@ namespace {
 
 using testing::_;
 using testing::AllOf;
+using testing::ByMove;
 using testing::Each;
+using testing::ExpectationSet;
 using testing::HasSubstr;
 using testing::Invoke;
 using testing::Property;
 using testing::Return;
+using testing::Sequence;
+using testing::SizeIs;
 using testing::StrictMock;
 
 using FieldElementT = TestFieldElement;
@@ -69,7 +74,10 @@ class CompositionOracleProverTester {
     }
   }
 
-  void TestEvalComposition(size_t degree_bound);
+  void TestEvalComposition(size_t degree_bound, bool bit_reversed_input = false);
+  FieldElementVector EvalCompositionOfRandomTraces(
+      const CachedLdeManager::Config& config, bool bit_reversed_input, size_t degree_bound,
+      size_t n_cosets_per_batch);
   void TestDecommitQueries();
   void TestInvalidMask();
 
@@ -89,8 +97,11 @@ class CompositionOracleProverTester {
   Tests CompositionOracleProverTester::EvalComposition(). Feeds random traces to
   CompositionOracleProverTester, and checks that
   CompositionPolynomial::EvalOnCosetBitReversedOutput() is called with parameters of correct sizes.
+  If bit_reversed_input is true, the composition polynomial accepts the columns in bit reversed
+  order, and EvalOnCosetBitReversedInputAndOutput() is called instead.
 */
-void CompositionOracleProverTester::TestEvalComposition(size_t degree_bound) {
+void CompositionOracleProverTester::TestEvalComposition(
+    size_t degree_bound, bool bit_reversed_input) {
   const size_t task_size = 32;
   FieldElementVector coset_offsets_bit_reversed(FieldElementVector::MakeUninitialized(
       evaluation_domain.GetField(), evaluation_domain.NumCosets()));
@@ -130,17 +141,27 @@ void CompositionOracleProverTester::TestEvalComposition(size_t degree_bound) {
   StrictMock<CompositionPolynomialMock> composition_polynomial;
   EXPECT_CALL(composition_polynomial, GetDegreeBound())
       .WillRepeatedly(Return(degree_bound * trace_length));
+  EXPECT_CALL(composition_polynomial, SupportsBitReversedInput())
+      .WillRepeatedly(Return(bit_reversed_input));
   for (uint64_t coset_index = 0; coset_index < degree_bound; coset_index++) {
     const FieldElement coset_offset = coset_offsets_bit_reversed[coset_index];
     // Test that each coset is computed with correct offset, and correct sizes of arguments.
-    EXPECT_CALL(
-        composition_polynomial,
-        EvalOnCosetBitReversedOutput(
-            coset_offset,
-            AllOf(
-                Property(&gsl::span<const ConstFieldElementSpan>::size, n_traces * n_columns),
-                Each(Property(&ConstFieldElementSpan::Size, trace_length))),
-            Property(&FieldElementSpan::Size, trace_length), task_size));
+    const auto trace_lde_matcher = AllOf(
+        Property(&gsl::span<const ConstFieldElementSpan>::size, n_traces * n_columns),
+        Each(Property(&ConstFieldElementSpan::Size, trace_length)));
+    if (bit_reversed_input) {
+      EXPECT_CALL(
+          composition_polynomial,
+          EvalOnCosetBitReversedInputAndOutput(
+              coset_offset, trace_lde_matcher, Property(&FieldElementSpan::Size, trace_length),
+              task_size));
+    } else {
+      EXPECT_CALL(
+          composition_polynomial,
+          EvalOnCosetBitReversedOutput(
+              coset_offset, trace_lde_matcher, Property(&FieldElementSpan::Size, trace_length),
+              task_size));
+    }
   }
 
   // Create CompositionOracleProver.
@@ -178,6 +199,10 @@ TEST(CompositionOracleProver, EvalComposition) {
   CompositionOracleProverTester(16, 4, 7, 2, MultiplicativeGroupOrdering::kBitReversedOrder)
       .TestEvalComposition(2);
 
+  // Test a composition polynomial which accepts bit reversed columns.
+  CompositionOracleProverTester(16, 4, 7, 2, MultiplicativeGroupOrdering::kBitReversedOrder)
+      .TestEvalComposition(2, true);
+
   // Test no cosets.
   EXPECT_ASSERT(
       CompositionOracleProverTester(16, 0, 7, 2, MultiplicativeGroupOrdering::kNaturalOrder)
@@ -194,8 +219,129 @@ TEST(CompositionOracleProver, EvalComposition) {
 }
 
 /*
-  Test CompositionPolynomialMock::DecommmitQueries(). Check that DecommitQueries() is called with
-  parameters of correct size.
+  Evaluates the composition of random traces (the same ones in every call) with the given LDE
+  configuration, where the mocked composition polynomial is a linear combination of the columns.
+*/
+FieldElementVector CompositionOracleProverTester::EvalCompositionOfRandomTraces(
+    const CachedLdeManager::Config& config, bool bit_reversed_input, size_t degree_bound,
+    size_t n_cosets_per_batch) {
+  const size_t task_size = 32;
+  const size_t log_trace_length = SafeLog2(trace_length);
+  FieldElementVector coset_offsets_bit_reversed(FieldElementVector::MakeUninitialized(
+      evaluation_domain.GetField(), evaluation_domain.NumCosets()));
+  const size_t log_cosets = SafeLog2(evaluation_domain.NumCosets());
+  for (uint64_t i = 0; i < coset_offsets_bit_reversed.Size(); ++i) {
+    coset_offsets_bit_reversed.Set(i, evaluation_domain.CosetsOffsets()[BitReverse(i, log_cosets)]);
+  }
+
+  Prng prng(MakeByteArray<0x01, 0x02>());
+  std::vector<CachedLdeManager> trace_ldes;
+  trace_ldes.reserve(n_traces);
+  for (size_t trace_i = 0; trace_i < n_traces; ++trace_i) {
+    CachedLdeManager cached_lde_manager(
+        config, TakeOwnershipFrom(MakeLdeManager(evaluation_domain.Bases())),
+        UseOwned(&coset_offsets_bit_reversed));
+    for (size_t column_i = 0; column_i < n_columns; ++column_i) {
+      cached_lde_manager.AddEvaluation(
+          FieldElementVector::Make(prng.RandomFieldElementVector<FieldElementT>(trace_length)));
+    }
+    cached_lde_manager.FinalizeAdding();
+    trace_ldes.emplace_back(std::move(cached_lde_manager));
+    EXPECT_CALL(*traces[trace_i], GetLde()).WillRepeatedly(Return(&trace_ldes[trace_i]));
+  }
+
+  // out[i] = sum_j (j + 1) * column_j[i], where the input is in natural order if
+  // bit_reversed_input is false, and the output is always in bit reversed order.
+  const auto linear_combination = [this, log_trace_length, bit_reversed_input](
+                                      gsl::span<const ConstFieldElementSpan> trace_lde,
+                                      const FieldElementSpan& out_evaluation) {
+    for (size_t i = 0; i < trace_length; ++i) {
+      FieldElementT sum = FieldElementT::Zero();
+      for (size_t j = 0; j < trace_lde.size(); ++j) {
+        sum += FieldElementT::FromUint(j + 1) * trace_lde[j].As<FieldElementT>()[i];
+      }
+      out_evaluation.Set(
+          bit_reversed_input ? i : BitReverse(i, log_trace_length), FieldElement(sum));
+    }
+  };
+  StrictMock<CompositionPolynomialMock> composition_polynomial;
+  EXPECT_CALL(composition_polynomial, GetDegreeBound())
+      .WillRepeatedly(Return(degree_bound * trace_length));
+  EXPECT_CALL(composition_polynomial, SupportsBitReversedInput())
+      .WillRepeatedly(Return(bit_reversed_input));
+  if (bit_reversed_input) {
+    EXPECT_CALL(composition_polynomial, EvalOnCosetBitReversedInputAndOutput(_, _, _, task_size))
+        .Times(degree_bound)
+        .WillRepeatedly(Invoke([&](const FieldElement& /*coset_offset*/, auto trace_lde,
+                                   const FieldElementSpan& out, uint64_t /*task_size*/) {
+          linear_combination(trace_lde, out);
+        }));
+  } else {
+    EXPECT_CALL(composition_polynomial, EvalOnCosetBitReversedOutput(_, _, _, task_size))
+        .Times(degree_bound)
+        .WillRepeatedly(Invoke([&](const FieldElement& /*coset_offset*/, auto trace_lde,
+                                   const FieldElementSpan& out, uint64_t /*task_size*/) {
+          linear_combination(trace_lde, out);
+        }));
+  }
+
+  std::vector<std::pair<int64_t, uint64_t>> mask;
+  CompositionOracleProver oracle_prover(
+      UseOwned(&evaluation_domain), std::move(traces_ptrs), mask, nullptr,
+      UseOwned(&composition_polynomial), &channel);
+  return oracle_prover.EvalComposition(task_size, n_cosets_per_batch);
+}
+
+/*
+  Checks that the composition does not depend on how the trace LDE is cached, nor on the order in
+  which the composition polynomial consumes the columns, nor on the number of cosets evaluated
+  together. In particular, checks that the cosets are not overwritten while they are used, as the
+  next coset is evaluated in parallel.
+*/
+TEST(CompositionOracleProver, EvalCompositionValues) {
+  const size_t trace_length = 16;
+  const size_t n_cosets = 8;
+  const size_t n_columns = 3;
+  const size_t n_traces = 2;
+  const size_t degree_bound = 4;
+  const auto eval = [&](const CachedLdeManager::Config& config, bool bit_reversed_input,
+                        size_t n_cosets_per_batch) {
+    return CompositionOracleProverTester(
+               trace_length, n_cosets, n_columns, n_traces,
+               MultiplicativeGroupOrdering::kBitReversedOrder)
+        .EvalCompositionOfRandomTraces(
+            config, bit_reversed_input, degree_bound, n_cosets_per_batch);
+  };
+
+  const CachedLdeManager::Config full_lde_config = {
+      /*store_full_lde=*/true,
+      /*use_fft_for_eval=*/false};
+  const CachedLdeManager::Config no_cache_config = {
+      /*store_full_lde=*/false,
+      /*use_fft_for_eval=*/false};
+  CachedLdeManager::Config bounded_cache_config = no_cache_config;
+  bounded_cache_config.max_cache_bytes = n_columns * trace_length * FieldElementT::SizeInBytes();
+
+  const FieldElementVector expected = eval(full_lde_config, false, 1);
+  for (const auto& config : {full_lde_config, no_cache_config, bounded_cache_config}) {
+    for (bool bit_reversed_input : {false, true}) {
+      // A batch of 3 cosets does not divide degree_bound, and a batch of 8 is larger than it.
+      for (size_t n_cosets_per_batch : {1, 2, 3, 8}) {
+        SCOPED_TRACE(
+            "store_full_lde: " + std::to_string(config.store_full_lde) +
+            ", max_cache_bytes: " + std::to_string(config.max_cache_bytes) +
+            ", bit_reversed_input: " + std::to_string(bit_reversed_input) +
+            ", n_cosets_per_batch: " + std::to_string(n_cosets_per_batch));
+        EXPECT_EQ(expected, eval(config, bit_reversed_input, n_cosets_per_batch));
+      }
+    }
+  }
+}
+
+/*
+  Test CompositionPolynomialMock::DecommmitQueries(). Check that PrepareDecommitment() is called with
+  parameters of correct size, and that the prepared decommitments are sent in the order of the
+  traces, after all of them were prepared.
 */
 void CompositionOracleProverTester::TestDecommitQueries() {
   Prng prng;
@@ -205,6 +351,7 @@ void CompositionOracleProverTester::TestDecommitQueries() {
 
   // Create CompositionOracleProver.
   std::vector<std::pair<int64_t, uint64_t>> mask;
+  ExpectationSet prepare_calls;
   for (size_t trace_i = 0; trace_i < n_traces; ++trace_i) {
     const size_t masks_items_in_trace = prng.UniformInt<size_t>(1, 5);
     const size_t column_offset = n_columns * trace_i;
@@ -212,10 +359,28 @@ void CompositionOracleProverTester::TestDecommitQueries() {
       mask.emplace_back(i, prng.UniformInt<size_t>(0, n_columns - 1) + column_offset);
     }
 
+    // Mark the prepared decommitment of each trace by the number of its columns.
+    CommittedTraceProverBase::PreparedDecommitment prepared;
+    for (size_t i = 0; i < trace_i; ++i) {
+      prepared.elements_data.push_back(FieldElementVector::Make<FieldElementT>());
+    }
+    prepare_calls +=
+        EXPECT_CALL(
+            *traces[trace_i],
+            PrepareDecommitment(Property(
+                &gsl::span<const std::tuple<uint64_t, uint64_t, size_t>>::size,
+                masks_items_in_trace)))
+            .WillOnce(Return(ByMove(std::move(prepared))));
+  }
+
+  Sequence decommit_sequence;
+  for (size_t trace_i = 0; trace_i < n_traces; ++trace_i) {
     EXPECT_CALL(
         *traces[trace_i],
-        DecommitQueries(Property(
-            &gsl::span<const std::tuple<uint64_t, uint64_t, size_t>>::size, masks_items_in_trace)));
+        Decommit(testing::Field(
+            &CommittedTraceProverBase::PreparedDecommitment::elements_data, SizeIs(trace_i))))
+        .InSequence(decommit_sequence)
+        .After(prepare_calls);
   }
 
   CompositionOracleProver oracle_prover(
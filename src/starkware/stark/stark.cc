@@ -220,8 +220,28 @@ StarkParameters StarkParameters::FromJson(
 StarkProverConfig StarkProverConfig::FromJson(const JsonValue& json) {
   const bool store_full_lde = json["cached_lde_config"]["store_full_lde"].AsBool();
   const bool use_fft_for_eval = json["cached_lde_config"]["use_fft_for_eval"].AsBool();
+  size_t log_n_tiles_per_coset = 0;
+  const JsonValue log_n_tiles = json["cached_lde_config"]["log_n_tiles_per_coset"];
+  if (log_n_tiles.HasValue()) {
+    log_n_tiles_per_coset = log_n_tiles.AsSizeT();
+  }
+  uint64_t max_cache_bytes = 0;
+  const JsonValue max_cache_bytes_json = json["cached_lde_config"]["max_cache_bytes"];
+  if (max_cache_bytes_json.HasValue()) {
+    max_cache_bytes = max_cache_bytes_json.AsUint64();
+  }
+  bool spill_evicted_cosets = false;
+  const JsonValue spill_json = json["cached_lde_config"]["spill_evicted_cosets"];
+  if (spill_json.HasValue()) {
+    spill_evicted_cosets = spill_json.AsBool();
+  }
   const uint64_t constraint_polynomial_task_size =
       json["constraint_polynomial_task_size"].AsUint64();
+  size_t n_composition_cosets_per_batch = 1;
+  const JsonValue n_cosets_per_batch_json = json["n_composition_cosets_per_batch"];
+  if (n_cosets_per_batch_json.HasValue()) {
+    n_composition_cosets_per_batch = n_cosets_per_batch_json.AsSizeT();
+  }
   const size_t table_prover_n_tasks_per_segment =
       json["table_prover_n_tasks_per_segment"].AsSizeT();
   const size_t n_out_of_memory_merkle_layers = json["n_out_of_memory_merkle_layers"].AsSizeT();
@@ -230,6 +250,7 @@ StarkProverConfig StarkProverConfig::FromJson(const JsonValue& json) {
   size_t max_non_chunked_layer_size = FriProverConfig::kDefaultMaxNonChunkedLayerSize;
   size_t n_chunks_between_layers = FriProverConfig::kDefaultNumberOfChunksBetweenLayers;
   size_t log_n_max_in_memory_fri_layer_elements = FriProverConfig::kAllInMemoryLayers;
+  uint64_t scratch_layer_chunk_bytes = 0;
   if (fri_prover_config.HasValue()) {
     const JsonValue max_layer_size = fri_prover_config["max_non_chunked_layer_size"];
     if (max_layer_size.HasValue()) {
@@ -245,20 +266,30 @@ StarkProverConfig StarkProverConfig::FromJson(const JsonValue& json) {
     if (log_n_in_memory_fri.HasValue()) {
       log_n_max_in_memory_fri_layer_elements = log_n_in_memory_fri.AsSizeT();
     }
+
+    const JsonValue scratch_chunk_bytes = fri_prover_config["scratch_layer_chunk_bytes"];
+    if (scratch_chunk_bytes.HasValue()) {
+      scratch_layer_chunk_bytes = scratch_chunk_bytes.AsUint64();
+    }
   }
 
   return {
       {
           /*store_full_lde=*/store_full_lde,
           /*use_fft_for_eval=*/use_fft_for_eval,
+          /*log_n_tiles_per_coset=*/log_n_tiles_per_coset,
+          /*max_cache_bytes=*/max_cache_bytes,
+          /*spill_evicted_cosets=*/spill_evicted_cosets,
       },
       /*table_prover_n_tasks_per_segment=*/table_prover_n_tasks_per_segment,
       /*constraint_polynomial_task_size=*/constraint_polynomial_task_size,
+      /*n_composition_cosets_per_batch=*/n_composition_cosets_per_batch,
       /*n_out_of_memory_merkle_layers=*/n_out_of_memory_merkle_layers,
       {
           /*max_non_chunked_layer_size=*/max_non_chunked_layer_size,
           /*n_chunks_between_layers=*/n_chunks_between_layers,
           /*log_n_max_in_memory_fri_layer_elements=*/log_n_max_in_memory_fri_layer_elements,
+          /*scratch_layer_chunk_bytes=*/scratch_layer_chunk_bytes,
       },
   };
 }
@@ -283,8 +314,8 @@ void StarkProver::PerformLowDegreeTest(const CompositionOracleProver& oracle) {
 
   ProfilingBlock profiling_block("FRI virtual oracle computation");
   // Evaluate composition polynomial.
-  auto composition_polynomial_evaluation =
-      oracle.EvalComposition(config_->constraint_polynomial_task_size);
+  auto composition_polynomial_evaluation = oracle.EvalComposition(
+      config_->constraint_polynomial_task_size, config_->n_composition_cosets_per_batch);
   profiling_block.CloseBlock();
 
   ProfilingBlock fri_profiling_block("FRI");
@@ -324,7 +355,8 @@ CompositionOracleProver StarkProver::OutOfDomainSamplingProve(
   const size_t n_breaks = original_oracle.ConstraintsDegreeBound();
 
   ProfilingBlock composition_block("Composition polynomial computation");
-  auto composition_eval = original_oracle.EvalComposition(config_->constraint_polynomial_task_size);
+  auto composition_eval = original_oracle.EvalComposition(
+      config_->constraint_polynomial_task_size, config_->n_composition_cosets_per_batch);
   composition_block.CloseBlock();
 
   ProfilingBlock breaker_block("Polynomial breaker");
@@ -92,6 +92,16 @@ struct StarkProverConfig {
     number of threads in the thread pool.
   */
   uint64_t constraint_polynomial_task_size;
+
+  /*
+    Number of cosets on which the composition polynomial is evaluated together. When it is 1, the
+    cosets are evaluated one after the other, and the traces are evaluated on the next coset while
+    the composition polynomial is evaluated on the current one. Larger values keep more threads
+    busy when the cosets are small, at the cost of keeping the trace LDE of that many cosets in
+    memory. See CompositionOracleProver::EvalComposition().
+  */
+  size_t n_composition_cosets_per_batch;
+
   /*
     Number of merkle layer that are not stored in memory but instead recalculated when required by
     decommitment request. When n_out_of_memory_merkle_layers is 0 it means that all the data is
@@ -110,6 +120,7 @@ struct StarkProverConfig {
         },
         /*table_prover_n_tasks_per_segment=*/32,
         /*constraint_polynomial_task_size=*/256,
+        /*n_composition_cosets_per_batch=*/1,
         /*n_out_of_memory_merkle_layers=*/1,
         {
             /*max_non_chunked_layer_size=*/FriProverConfig::kDefaultMaxNonChunkedLayerSize,
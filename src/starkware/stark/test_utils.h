@@ -29,10 +29,11 @@ template <typename HashT, typename FieldElementT>
 std::unique_ptr<TableVerifier> MakeTableVerifier(
     const Field& field, uint64_t n_rows, uint64_t n_columns, VerifierChannel* channel,
     size_t n_verifier_friendly_commitment_layers = 0,
-    CommitmentHashes commitment_hashes = CommitmentHashes(HashT::HashName())) {
+    CommitmentHashes commitment_hashes = CommitmentHashes(HashT::HashName()),
+    size_t merkle_cap_height = 0) {
   auto commitment_scheme_verifier = MakeCommitmentSchemeVerifier<HashT>(
       n_columns * FieldElementT::SizeInBytes(), n_rows, channel,
-      n_verifier_friendly_commitment_layers, commitment_hashes);
+      n_verifier_friendly_commitment_layers, commitment_hashes, merkle_cap_height);
 
   return std::make_unique<TableVerifierImpl>(
       field, n_columns, UseMovedValue(std::move(commitment_scheme_verifier)), channel);
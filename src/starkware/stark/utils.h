@@ -37,7 +37,7 @@ template <typename HashT>
 TableProverFactory GetTableProverFactory(
     ProverChannel* channel, size_t field_element_size_in_bytes, size_t n_tasks_per_segment,
     size_t n_out_of_memory_merkle_layers, size_t n_verifier_friendly_commitment_layers,
-    const CommitmentHashes& commitment_hashes);
+    const CommitmentHashes& commitment_hashes, size_t merkle_cap_height = 0);
 
 }  // namespace starkware
 
@@ -27,9 +27,9 @@ template <typename HashT>
 TableProverFactory GetTableProverFactory(
     ProverChannel* channel, size_t field_element_size_in_bytes, size_t n_tasks_per_segment,
     size_t n_out_of_memory_merkle_layers, size_t n_verifier_friendly_commitment_layers,
-    const CommitmentHashes& commitment_hashes) {
+    const CommitmentHashes& commitment_hashes, size_t merkle_cap_height) {
   return [channel, field_element_size_in_bytes, n_tasks_per_segment, n_out_of_memory_merkle_layers,
-          n_verifier_friendly_commitment_layers, commitment_hashes](
+          n_verifier_friendly_commitment_layers, commitment_hashes, merkle_cap_height](
              size_t n_segments, uint64_t n_rows_per_segment,
              size_t n_columns) -> std::unique_ptr<TableProver> {
     bool use_parallel_prover = false;
@@ -53,7 +53,8 @@ TableProverFactory GetTableProverFactory(
 
     auto packaging_commitment_scheme = MakeCommitmentSchemeProver<HashT>(
         field_element_size_in_bytes * n_columns, n_rows_per_segment, n_segments, channel,
-        n_verifier_friendly_commitment_layers, commitment_hashes, n_out_of_memory_merkle_layers);
+        n_verifier_friendly_commitment_layers, commitment_hashes, n_out_of_memory_merkle_layers,
+        merkle_cap_height);
 
     auto table_prover = std::make_unique<TableProverImpl>(
         n_columns, UseMovedValue(std::move(packaging_commitment_scheme)), channel);
@@ -20,10 +20,12 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "starkware/crypt_tools/keccak_256.h"
 #include "starkware/crypt_tools/pedersen.h"
 #include "starkware/math/math.h"
+#include "starkware/utils/task_manager.h"
 
 namespace starkware {
 namespace cpu {
@@ -207,14 +209,26 @@ void CpuAirStatement::SerializePublicMemory(
       [&](auto hash_tag) {
         using HashT = typename decltype(hash_tag)::type;
 
+        // The pages are independent, so they are hashed in parallel.
+        std::vector<const PublicInputSerializer*> pages;
+        pages.reserve(page_serializers.size());
+        for (const auto& [page, page_serializer] : page_serializers) {
+          pages.push_back(&page_serializer);
+        }
+        std::vector<HashT> page_hashes(pages.size());
+        TaskManager::GetInstance().ParallelFor(pages.size(), [&](const TaskInfo& task_info) {
+          for (size_t i = task_info.start_idx; i < task_info.end_idx; ++i) {
+            page_hashes[i] = HashT::HashBytesWithLength(pages[i]->GetSerializedVector());
+          }
+        });
+
+        size_t page_idx = 0;
         for (const auto& [page, page_serializer] : page_serializers) {
-          const auto public_memory_hash =
-              HashT::HashBytesWithLength(page_serializer.GetSerializedVector());
           if (page != 0) {
             serializer->Append(BigInt<4>(page_start_addr[page]));
           }
           serializer->Append(BigInt<4>(page_sizes.at(page)));
-          serializer->AddBytes(public_memory_hash.GetDigest());
+          serializer->AddBytes(page_hashes[page_idx++].GetDigest());
         }
       },
       /*chooser_func=*/
@@ -0,0 +1,76 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include "starkware/utils/scratch_vector.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "glog/logging.h"
+
+#include "starkware/error_handling/error_handling.h"
+#include "starkware/math/math.h"
+
+DEFINE_string(
+    scratch_dir, "",
+    "Optional. A directory for memory-mapped scratch files, which hold large commitment layers "
+    "instead of RAM.");
+DEFINE_uint64(
+    min_scratch_file_size, uint64_t(1) << 30,
+    "Buffers smaller than this number of bytes are kept in RAM even if --scratch_dir is set.");
+
+namespace starkware {
+
+namespace {
+
+constexpr size_t kHugePageSize = size_t(1) << 21;
+
+}  // namespace
+
+ScratchFileMapping::ScratchFileMapping(const std::string& directory, const size_t size_in_bytes)
+    : mapped_size_(DivCeil(std::max<size_t>(size_in_bytes, 1), kHugePageSize) * kHugePageSize) {
+  std::string path = directory + "/starkware_scratch_XXXXXX";
+  const int fd = mkstemp(path.data());
+  ASSERT_RELEASE(
+      fd >= 0, "Failed to create a scratch file in " + directory + ": " + std::strerror(errno));
+  // Unlink the file right away, so it is removed once it is unmapped, even on a crash.
+  unlink(path.c_str());
+  ASSERT_RELEASE(
+      ftruncate(fd, mapped_size_) == 0,
+      "Failed to resize scratch file to " + std::to_string(mapped_size_) +
+          " bytes: " + std::strerror(errno));
+  void* addr = mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const int mmap_errno = errno;
+  close(fd);
+  ASSERT_RELEASE(addr != MAP_FAILED, std::string("mmap failed: ") + std::strerror(mmap_errno));
+  data_ = static_cast<std::byte*>(addr);
+  // The buffer is usually written sequentially during the commitment phase. madvise() is only a
+  // hint, so its result is ignored.
+  madvise(addr, mapped_size_, MADV_SEQUENTIAL);
+  VLOG(2) << "Mapped a scratch file of " << mapped_size_ << " bytes in " << directory;
+}
+
+ScratchFileMapping::~ScratchFileMapping() { munmap(data_, mapped_size_); }
+
+void ScratchFileMapping::AdviseRandomAccess() const { madvise(data_, mapped_size_, MADV_RANDOM); }
+
+void ScratchFileMapping::AdviseWillNeed() const { madvise(data_, mapped_size_, MADV_WILLNEED); }
+
+}  // namespace starkware
@@ -0,0 +1,125 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#ifndef STARKWARE_UTILS_SCRATCH_VECTOR_H_
+#define STARKWARE_UTILS_SCRATCH_VECTOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "gflags/gflags.h"
+#include "third_party/gsl/gsl-lite.hpp"
+
+DECLARE_string(scratch_dir);
+DECLARE_uint64(min_scratch_file_size);
+
+namespace starkware {
+
+/*
+  A read-write memory mapping of an anonymous (unlinked) file in a given directory. The file is
+  removed from the file system when the mapping is destroyed (or if the process crashes).
+  The size of the file is rounded up to a multiple of the huge page size.
+*/
+class ScratchFileMapping {
+ public:
+  ScratchFileMapping(const std::string& directory, size_t size_in_bytes);
+  ~ScratchFileMapping();
+
+  ScratchFileMapping(const ScratchFileMapping&) = delete;
+  ScratchFileMapping& operator=(const ScratchFileMapping&) = delete;
+  ScratchFileMapping(ScratchFileMapping&&) = delete;
+  ScratchFileMapping& operator=(ScratchFileMapping&&) = delete;
+
+  std::byte* Data() const { return data_; }
+
+  /*
+    Hints the OS that the mapping is about to be read in a random order (e.g., in the decommitment
+    phase), so there is no point in reading ahead.
+  */
+  void AdviseRandomAccess() const;
+
+  /*
+    Hints the OS that the whole mapping is about to be read, so it can be read ahead.
+  */
+  void AdviseWillNeed() const;
+
+ private:
+  std::byte* data_ = nullptr;
+  size_t mapped_size_ = 0;
+};
+
+/*
+  A fixed-size array of trivially copyable elements, used for large buffers which are written once
+  (sequentially) and then read sparsely.
+  When --scratch_dir is set and the buffer is at least --min_scratch_file_size bytes, the elements
+  are stored in a memory-mapped scratch file in that directory, and the OS page cache decides which
+  parts of it are kept in RAM. Otherwise, the elements are stored in an std::vector, and are
+  value-initialized.
+*/
+template <typename T>
+class ScratchVector {
+  static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+
+ public:
+  explicit ScratchVector(size_t size) : size_(size) {
+    if (!FLAGS_scratch_dir.empty() && size * sizeof(T) >= FLAGS_min_scratch_file_size) {
+      mapping_ = std::make_unique<ScratchFileMapping>(FLAGS_scratch_dir, size * sizeof(T));
+    } else {
+      in_memory_.resize(size);
+    }
+  }
+
+  T* data() { return mapping_ ? reinterpret_cast<T*>(mapping_->Data()) : in_memory_.data(); }
+  const T* data() const {
+    return mapping_ ? reinterpret_cast<const T*>(mapping_->Data()) : in_memory_.data();
+  }
+  size_t size() const { return size_; }
+
+  T* begin() { return data(); }
+  T* end() { return data() + size_; }
+  const T* begin() const { return data(); }
+  const T* end() const { return data() + size_; }
+
+  T& operator[](size_t i) { return data()[i]; }
+  const T& operator[](size_t i) const { return data()[i]; }
+
+  gsl::span<T> AsSpan() { return gsl::make_span(data(), size_); }
+  gsl::span<const T> AsSpan() const { return gsl::make_span(data(), size_); }
+
+  /*
+    Returns true if the elements are stored in a scratch file.
+  */
+  bool IsMapped() const { return mapping_ != nullptr; }
+
+  /*
+    See ScratchFileMapping::AdviseRandomAccess(). Does nothing for in-memory buffers.
+  */
+  void AdviseRandomAccess() const {
+    if (mapping_) {
+      mapping_->AdviseRandomAccess();
+    }
+  }
+
+ private:
+  size_t size_;
+  std::vector<T> in_memory_;
+  std::unique_ptr<ScratchFileMapping> mapping_;
+};
+
+}  // namespace starkware
+
+#endif  // STARKWARE_UTILS_SCRATCH_VECTOR_H_
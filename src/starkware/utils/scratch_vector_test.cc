@@ -0,0 +1,87 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#include "starkware/utils/scratch_vector.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+#include "starkware/error_handling/test_utils.h"
+
+namespace starkware {
+namespace {
+
+using testing::HasSubstr;
+
+/*
+  Sets the scratch flags for the lifetime of the object.
+*/
+class ScopedScratchFlags {
+ public:
+  ScopedScratchFlags(const std::string& scratch_dir, uint64_t min_scratch_file_size)
+      : prev_scratch_dir_(FLAGS_scratch_dir), prev_min_size_(FLAGS_min_scratch_file_size) {
+    FLAGS_scratch_dir = scratch_dir;
+    FLAGS_min_scratch_file_size = min_scratch_file_size;
+  }
+  ~ScopedScratchFlags() {
+    FLAGS_scratch_dir = prev_scratch_dir_;
+    FLAGS_min_scratch_file_size = prev_min_size_;
+  }
+
+ private:
+  const std::string prev_scratch_dir_;
+  const uint64_t prev_min_size_;
+};
+
+void TestWriteAndRead(ScratchVector<uint64_t>* vec) {
+  std::iota(vec->begin(), vec->end(), 7);
+  for (size_t i = 0; i < vec->size(); ++i) {
+    ASSERT_EQ((*vec)[i], i + 7);
+  }
+  vec->AdviseRandomAccess();
+  const auto span = static_cast<const ScratchVector<uint64_t>*>(vec)->AsSpan();
+  EXPECT_TRUE(std::equal(span.begin(), span.end(), vec->begin()));
+}
+
+TEST(ScratchVector, InMemoryByDefault) {
+  ScratchVector<uint64_t> vec(1000);
+  EXPECT_FALSE(vec.IsMapped());
+  EXPECT_EQ(vec.size(), 1000U);
+  EXPECT_TRUE(std::all_of(vec.begin(), vec.end(), [](uint64_t x) { return x == 0; }));
+  TestWriteAndRead(&vec);
+}
+
+TEST(ScratchVector, Mapped) {
+  ScopedScratchFlags flags(::testing::TempDir(), 0);
+  ScratchVector<uint64_t> vec(1000);
+  EXPECT_TRUE(vec.IsMapped());
+  EXPECT_EQ(vec.size(), 1000U);
+  TestWriteAndRead(&vec);
+}
+
+TEST(ScratchVector, SmallBufferStaysInMemory) {
+  ScopedScratchFlags flags(::testing::TempDir(), 8001);
+  EXPECT_FALSE(ScratchVector<uint64_t>(1000).IsMapped());
+  EXPECT_TRUE(ScratchVector<uint64_t>(1001).IsMapped());
+}
+
+TEST(ScratchVector, MissingDirectory) {
+  ScopedScratchFlags flags("/nonexistent_scratch_dir", 0);
+  EXPECT_ASSERT(ScratchVector<uint64_t>(1000), HasSubstr("Failed to create a scratch file"));
+}
+
+}  // namespace
+}  // namespace starkware
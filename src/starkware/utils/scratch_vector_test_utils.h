@@ -0,0 +1,40 @@
+// Copyright 2023 StarkWare Industries Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.starkware.co/open-source-license/
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions
+// and limitations under the License.
+
+#ifndef STARKWARE_UTILS_SCRATCH_VECTOR_TEST_UTILS_H_
+#define STARKWARE_UTILS_SCRATCH_VECTOR_TEST_UTILS_H_
+
+#include <string>
+
+#include "starkware/utils/scratch_vector.h"
+
+namespace starkware {
+
+/*
+  Sets --scratch_dir for the lifetime of the object.
+*/
+class ScopedScratchDir {
+ public:
+  explicit ScopedScratchDir(const std::string& scratch_dir) : prev_scratch_dir_(FLAGS_scratch_dir) {
+    FLAGS_scratch_dir = scratch_dir;
+  }
+  ~ScopedScratchDir() { FLAGS_scratch_dir = prev_scratch_dir_; }
+
+ private:
+  const std::string prev_scratch_dir_;
+};
+
+}  // namespace starkware
+
+#endif  // STARKWARE_UTILS_SCRATCH_VECTOR_TEST_UTILS_H_